@@ -0,0 +1,549 @@
+/**
+ * @brief Round-trip accuracy and throughput sweep.
+ * @file accuracySweep.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Generates points over the whole globe and altitude range, runs them
+ * through the LLA-ECF-LLA, AER-ECF-AER and ENU-DCA-ENU round trips on every
+ * available path (scalar classes and solvers, batch conversions at each SIMD
+ * level, the float templates) and reports forward, inverse and round-trip
+ * position errors against a long double reference together with the throughput
+ * of each path.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+/*
+ * Build with optimization together with every source file in src/, with
+ * include/ on the include path, and link the thread library.
+ *
+ * Usage: accuracySweep [--format json|csv] [--points N] [--frames F]
+ *     [--output FILE]
+ *
+ * Every error is a position error in meters: results are mapped back to ECF
+ * (or to the local axes for ENU-DCA) in long double and compared with the
+ * long double image of the true point, so angles near the poles and at long
+ * range are weighted by the distance they actually represent.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "coordinateSystems.h"
+#include "conversionKernels.h"
+#include "localFrame.h"
+#include "batchConversions.h"
+
+using namespace coordinateSystems;
+using namespace coordinateSystems::kernels;
+
+typedef long double real;
+
+/***** reference **************************************************************/
+/*
+ * A local frame in double for the library and in long double for the
+ * reference.
+ */
+struct sweepFrame {
+    LocalFrame frame;
+    real origin[3];
+    real rotation[3][3]; //rows DownRange, CrossRange, Above in ECF
+    sweepFrame(double latitude, double longitude, double altitude, double heading) :
+    frame(latitude,longitude,altitude,heading){
+        real enu[3][3], sinHeading, cosHeading;
+        llaToECFSinCos<real>(latitude,longitude,altitude,WGS84::a,WGS84::e2,origin[0],origin[1],origin[2]);
+        enuRotation<real>(latitude,longitude,enu);
+        sincosDegrees((real)heading,sinHeading,cosHeading);
+        for (int i = 0; i < 3; i++) {
+            rotation[0][i] = enu[0][i]*sinHeading + enu[1][i]*cosHeading;
+            rotation[1][i] = -enu[0][i]*cosHeading + enu[1][i]*sinHeading;
+            rotation[2][i] = enu[2][i];
+        }
+    }
+};
+
+static void referenceECF(const double *lla, real ecf[3]){
+    llaToECFSinCos<real>(lla[0],lla[1],lla[2],WGS84::a,WGS84::e2,ecf[0],ecf[1],ecf[2]);
+}
+
+static void referenceECF(const double *aer, const sweepFrame &frame, real ecf[3]){
+    real dca[3];
+    aerToDCAPolar<real>(aer[0],aer[1],aer[2],dca[0],dca[1],dca[2]);
+    rotateFromLocal(dca[0],dca[1],dca[2],frame.origin,frame.rotation,ecf[0],ecf[1],ecf[2]);
+}
+
+static double distance(const real a[3], const real b[3]){
+    return (double)sqrtl((a[0]-b[0])*(a[0]-b[0]) + (a[1]-b[1])*(a[1]-b[1]) + (a[2]-b[2])*(a[2]-b[2]));
+}
+
+static double distance(const double *a, const real b[3]){
+    real c[3] = {a[0], a[1], a[2]};
+    return distance(c,b);
+}
+
+/***** inputs *****************************************************************/
+/*
+ * Points spread evenly over the sphere; half at terrain and aircraft
+ * altitudes, half up to 40,000 km. Local points are AER vectors up to
+ * 1000 km in every direction from frames scattered over the globe.
+ */
+struct sweepInputs {
+    std::vector<sweepFrame> frames;
+    std::vector<double> lla, aer, enu;
+    size_t count, perFrame;
+};
+
+static sweepInputs makeInputs(size_t count, size_t frameCount){
+    std::mt19937_64 generator(2026);
+    std::uniform_real_distribution<double> unit(0.0,1.0);
+    sweepInputs inputs;
+
+    for (size_t f = 0; f < frameCount; f++) {
+        inputs.frames.push_back(sweepFrame(asin(2.0*unit(generator) - 1.0)*degPerRad,
+                -180.0 + 360.0*unit(generator),10000.0*unit(generator),360.0*unit(generator)));
+    }
+    inputs.perFrame = (count + frameCount - 1)/frameCount;
+    inputs.count = inputs.perFrame*frameCount;
+    inputs.lla.resize(3*inputs.count);
+    inputs.aer.resize(3*inputs.count);
+    inputs.enu.resize(3*inputs.count);
+    for (size_t i = 0; i < inputs.count; i++) {
+        inputs.lla[3*i] = asin(2.0*unit(generator) - 1.0)*degPerRad;
+        inputs.lla[3*i+1] = -180.0 + 360.0*unit(generator);
+        inputs.lla[3*i+2] = (i % 2) ? 4.0e7*unit(generator) : -500.0 + 20500.0*unit(generator);
+        inputs.aer[3*i] = -180.0 + 360.0*unit(generator);
+        inputs.aer[3*i+1] = asin(2.0*unit(generator) - 1.0)*degPerRad;
+        inputs.aer[3*i+2] = 1.0e6*unit(generator);
+        inputs.enu[3*i] = -1.0e6 + 2.0e6*unit(generator);
+        inputs.enu[3*i+1] = -1.0e6 + 2.0e6*unit(generator);
+        inputs.enu[3*i+2] = -1.0e6 + 2.0e6*unit(generator);
+    }
+    return inputs;
+}
+
+/***** paths ******************************************************************/
+/*
+ * One path for a round trip: a forward and an inverse conversion over
+ * interleaved arrays of points that share a frame.
+ */
+typedef std::function<void(size_t, const double*, double*, sweepFrame&)> step;
+
+struct sweepPath {
+    std::string roundTrip, path;
+    step forward, inverse;
+};
+
+static std::string simdName(simdLevel level){
+    switch (level) {
+        case SIMD_SSE2: return "batch-sse2";
+        case SIMD_AVX2: return "batch-avx2";
+        case SIMD_AVX512: return "batch-avx512";
+        default: return "batch-none";
+    }
+}
+
+//batch paths run at the SIMD level given in the path
+static void useLevel(const std::string &path){
+    for (int level = SIMD_NONE; level <= SIMD_AVX512; level++) {
+        if (path == simdName((simdLevel)level)) {
+            setSimdLevel((simdLevel)level);
+        }
+    }
+}
+
+static std::vector<sweepPath> geodeticPaths(){
+    std::vector<sweepPath> paths;
+    const char *solverNames[] = {"class-iterative", "class-fixed1", "class-fixed2", "class-millimetre", "class-closed-form"};
+    const geodeticSolver solvers[] = {GEODETIC_ITERATIVE, GEODETIC_FIXED, GEODETIC_FIXED, GEODETIC_MILLIMETRE, GEODETIC_CLOSED_FORM};
+    const unsigned iterations[] = {1, 1, 2, 1, 1};
+    step classForward = [](size_t n, const double *in, double *out, sweepFrame&){
+        for (size_t i = 0; i < n; i++) {
+            LLA::toECF(in[3*i],in[3*i+1],in[3*i+2],out[3*i],out[3*i+1],out[3*i+2]);
+        }
+    };
+
+    for (int s = 0; s < 5; s++) {
+        geodeticSolver solver = solvers[s];
+        unsigned count = iterations[s];
+        paths.push_back(sweepPath{"LLA-ECF-LLA", solverNames[s], classForward,
+            [solver,count](size_t n, const double *in, double *out, sweepFrame&){
+                for (size_t i = 0; i < n; i++) {
+                    ECF::toLLA(in[3*i],in[3*i+1],in[3*i+2],out[3*i],out[3*i+1],out[3*i+2],solver,count);
+                }
+            }});
+    }
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        paths.push_back(sweepPath{"LLA-ECF-LLA", simdName((simdLevel)level),
+            [](size_t n, const double *in, double *out, sweepFrame&){ llaToECF(n,in,out); },
+            [](size_t n, const double *in, double *out, sweepFrame&){ ecfToLLA(n,in,out); }});
+    }
+    paths.push_back(sweepPath{"LLA-ECF-LLA", "float",
+        [](size_t n, const double *in, double *out, sweepFrame&){
+            for (size_t i = 0; i < n; i++) {
+                float x, y, z;
+                llaToECFSinCos((float)in[3*i],(float)in[3*i+1],(float)in[3*i+2],WGS84::a,WGS84::e2,x,y,z);
+                out[3*i] = x; out[3*i+1] = y; out[3*i+2] = z;
+            }
+        },
+        [](size_t n, const double *in, double *out, sweepFrame&){
+            for (size_t i = 0; i < n; i++) {
+                float latitude, longitude, altitude;
+                ecfToLLAClosedForm((float)in[3*i],(float)in[3*i+1],(float)in[3*i+2],WGS84::a,WGS84::e2,latitude,longitude,altitude);
+                out[3*i] = latitude; out[3*i+1] = longitude; out[3*i+2] = altitude;
+            }
+        }});
+    return paths;
+}
+
+static std::vector<sweepPath> localPaths(){
+    std::vector<sweepPath> paths;
+
+    paths.push_back(sweepPath{"AER-ECF-AER", "class",
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            LLA origin = f.frame.getOrigin();
+            double heading = f.frame.getHeading();
+            for (size_t i = 0; i < n; i++) {
+                ECF ecf = AER(in[3*i],in[3*i+1],in[3*i+2],origin,heading).toECF();
+                out[3*i] = ecf.getFirstCoordinate(); out[3*i+1] = ecf.getSecondCoordinate(); out[3*i+2] = ecf.getThirdCoordinate();
+            }
+        },
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            LLA origin = f.frame.getOrigin();
+            double heading = f.frame.getHeading();
+            for (size_t i = 0; i < n; i++) {
+                AER aer = ECF(in[3*i],in[3*i+1],in[3*i+2]).toAER(origin,heading);
+                out[3*i] = aer.getFirstCoordinate(); out[3*i+1] = aer.getSecondCoordinate(); out[3*i+2] = aer.getThirdCoordinate();
+            }
+        }});
+    paths.push_back(sweepPath{"AER-ECF-AER", "local-frame",
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            for (size_t i = 0; i < n; i++) {
+                ECFVec ecf = f.frame.toECF(AERVec(in[3*i],in[3*i+1],in[3*i+2]));
+                out[3*i] = ecf.first; out[3*i+1] = ecf.second; out[3*i+2] = ecf.third;
+            }
+        },
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            for (size_t i = 0; i < n; i++) {
+                AERVec aer = f.frame.toAER(ECFVec(in[3*i],in[3*i+1],in[3*i+2]));
+                out[3*i] = aer.first; out[3*i+1] = aer.second; out[3*i+2] = aer.third;
+            }
+        }});
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        paths.push_back(sweepPath{"AER-ECF-AER", simdName((simdLevel)level),
+            [](size_t n, const double *in, double *out, sweepFrame &f){ aerToECF(n,in,out,f.frame); },
+            [](size_t n, const double *in, double *out, sweepFrame &f){ ecfToAER(n,in,out,f.frame); }});
+    }
+    paths.push_back(sweepPath{"AER-ECF-AER", "float",
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            float origin[3], rotation[3][3];
+            for (int i = 0; i < 3; i++) {
+                origin[i] = (float)f.origin[i];
+                for (int j = 0; j < 3; j++) {
+                    rotation[i][j] = (float)f.rotation[i][j];
+                }
+            }
+            for (size_t i = 0; i < n; i++) {
+                float d, c, a, x, y, z;
+                aerToDCAPolar((float)in[3*i],(float)in[3*i+1],(float)in[3*i+2],d,c,a);
+                rotateFromLocal(d,c,a,origin,rotation,x,y,z);
+                out[3*i] = x; out[3*i+1] = y; out[3*i+2] = z;
+            }
+        },
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            float origin[3], rotation[3][3];
+            for (int i = 0; i < 3; i++) {
+                origin[i] = (float)f.origin[i];
+                for (int j = 0; j < 3; j++) {
+                    rotation[i][j] = (float)f.rotation[i][j];
+                }
+            }
+            for (size_t i = 0; i < n; i++) {
+                float d, c, a, azimuth, elevation, range;
+                rotateToLocal((float)in[3*i],(float)in[3*i+1],(float)in[3*i+2],origin,rotation,d,c,a);
+                dcaToAERPolar(d,c,a,azimuth,elevation,range);
+                out[3*i] = azimuth; out[3*i+1] = elevation; out[3*i+2] = range;
+            }
+        }});
+
+    paths.push_back(sweepPath{"ENU-DCA-ENU", "class",
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            double heading = f.frame.getHeading();
+            for (size_t i = 0; i < n; i++) {
+                DCA dca = ENU(in[3*i],in[3*i+1],in[3*i+2]).toDCA(heading);
+                out[3*i] = dca.getFirstCoordinate(); out[3*i+1] = dca.getSecondCoordinate(); out[3*i+2] = dca.getThirdCoordinate();
+            }
+        },
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            double heading = f.frame.getHeading();
+            for (size_t i = 0; i < n; i++) {
+                ENU enu = DCA(in[3*i],in[3*i+1],in[3*i+2],heading).toENU();
+                out[3*i] = enu.getFirstCoordinate(); out[3*i+1] = enu.getSecondCoordinate(); out[3*i+2] = enu.getThirdCoordinate();
+            }
+        }});
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        paths.push_back(sweepPath{"ENU-DCA-ENU", simdName((simdLevel)level),
+            [](size_t n, const double *in, double *out, sweepFrame &f){ enuToDCA(n,in,out,f.frame); },
+            [](size_t n, const double *in, double *out, sweepFrame &f){ dcaToENU(n,in,out,f.frame); }});
+    }
+    paths.push_back(sweepPath{"ENU-DCA-ENU", "float",
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            float heading = (float)f.frame.getHeading();
+            for (size_t i = 0; i < n; i++) {
+                float d, c, a;
+                enuToDCARotation((float)in[3*i],(float)in[3*i+1],(float)in[3*i+2],heading,d,c,a);
+                out[3*i] = d; out[3*i+1] = c; out[3*i+2] = a;
+            }
+        },
+        [](size_t n, const double *in, double *out, sweepFrame &f){
+            float heading = (float)f.frame.getHeading();
+            for (size_t i = 0; i < n; i++) {
+                float e, nn, u;
+                dcaToENURotation((float)in[3*i],(float)in[3*i+1],(float)in[3*i+2],heading,e,nn,u);
+                out[3*i] = e; out[3*i+1] = nn; out[3*i+2] = u;
+            }
+        }});
+    return paths;
+}
+
+/***** sweep ******************************************************************/
+struct errorStats {
+    double max, p50, p99, p999;
+};
+
+struct sweepResult {
+    std::string roundTrip, path;
+    errorStats forward, inverse, roundTripError;
+    double nsPerPoint;
+};
+
+static errorStats summarize(std::vector<double> &errors){
+    errorStats stats;
+    size_t n = errors.size();
+    std::sort(errors.begin(),errors.end());
+    stats.max = errors[n-1];
+    stats.p50 = errors[n/2];
+    stats.p99 = errors[std::min(n-1,(size_t)(0.99*n))];
+    stats.p999 = errors[std::min(n-1,(size_t)(0.999*n))];
+    return stats;
+}
+
+/*
+ * Reference images of the true points: ECF for the geodetic and AER round
+ * trips, DCA for the ENU round trip.
+ */
+static std::vector<real> referenceImages(const std::string &roundTrip, sweepInputs &inputs){
+    std::vector<real> images(3*inputs.count);
+    for (size_t i = 0; i < inputs.count; i++) {
+        sweepFrame &f = inputs.frames[i/inputs.perFrame];
+        if (roundTrip == "LLA-ECF-LLA") {
+            referenceECF(&inputs.lla[3*i],&images[3*i]);
+        } else if (roundTrip == "AER-ECF-AER") {
+            referenceECF(&inputs.aer[3*i],f,&images[3*i]);
+        } else {
+            enuToDCARotation<real>(inputs.enu[3*i],inputs.enu[3*i+1],inputs.enu[3*i+2],f.frame.getHeading(),
+                    images[3*i],images[3*i+1],images[3*i+2]);
+        }
+    }
+    return images;
+}
+
+//position error of a point given in the round trip's starting frame
+static double startError(const std::string &roundTrip, const double *point, const real image[3], sweepFrame &f){
+    real ecf[3];
+    if (roundTrip == "LLA-ECF-LLA") {
+        referenceECF(point,ecf);
+        return distance(ecf,image);
+    } else if (roundTrip == "AER-ECF-AER") {
+        referenceECF(point,f,ecf);
+        return distance(ecf,image);
+    }
+    real dca[3];
+    enuToDCARotation<real>(point[0],point[1],point[2],f.frame.getHeading(),dca[0],dca[1],dca[2]);
+    return distance(dca,image);
+}
+
+static sweepResult sweep(sweepPath &path, sweepInputs &inputs, const std::vector<real> &images){
+    const std::vector<double> &start = (path.roundTrip == "LLA-ECF-LLA") ? inputs.lla :
+        (path.roundTrip == "AER-ECF-AER") ? inputs.aer : inputs.enu;
+    std::vector<double> middle(3*inputs.count), back(3*inputs.count), exact(3*inputs.count), inverse(3*inputs.count);
+    std::vector<double> forwardErrors(inputs.count), inverseErrors(inputs.count), roundTripErrors(inputs.count);
+    size_t m = inputs.perFrame;
+
+    useLevel(path.path);
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (size_t f = 0; f < inputs.frames.size(); f++) {
+        path.forward(m,&start[3*f*m],&middle[3*f*m],inputs.frames[f]);
+        path.inverse(m,&middle[3*f*m],&back[3*f*m],inputs.frames[f]);
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    //inverse alone, from the reference image rounded to double
+    for (size_t i = 0; i < 3*inputs.count; i++) {
+        exact[i] = (double)images[i];
+    }
+    for (size_t f = 0; f < inputs.frames.size(); f++) {
+        path.inverse(m,&exact[3*f*m],&inverse[3*f*m],inputs.frames[f]);
+    }
+
+    for (size_t i = 0; i < inputs.count; i++) {
+        sweepFrame &f = inputs.frames[i/m];
+        forwardErrors[i] = distance(&middle[3*i],&images[3*i]);
+        inverseErrors[i] = startError(path.roundTrip,&inverse[3*i],&images[3*i],f);
+        roundTripErrors[i] = startError(path.roundTrip,&back[3*i],&images[3*i],f);
+    }
+
+    sweepResult result;
+    result.roundTrip = path.roundTrip;
+    result.path = path.path;
+    result.forward = summarize(forwardErrors);
+    result.inverse = summarize(inverseErrors);
+    result.roundTripError = summarize(roundTripErrors);
+    result.nsPerPoint = std::chrono::duration<double,std::nano>(end - begin).count()/inputs.count;
+    return result;
+}
+
+/***** output *****************************************************************/
+static void writeStats(FILE *file, const char *name, const errorStats &stats, bool json){
+    if (json) {
+        fprintf(file,"\"%s\": {\"max\": %.3e, \"p50\": %.3e, \"p99\": %.3e, \"p999\": %.3e}",
+                name,stats.max,stats.p50,stats.p99,stats.p999);
+    } else {
+        fprintf(file,",%.3e,%.3e,%.3e,%.3e",stats.max,stats.p50,stats.p99,stats.p999);
+    }
+}
+
+static void writeJSON(FILE *file, const std::vector<sweepResult> &results, size_t count, size_t frames){
+    fprintf(file,"{\n  \"points\": %zu,\n  \"frames\": %zu,\n  \"error_unit\": \"m\",\n  \"results\": [\n",count,frames);
+    for (size_t i = 0; i < results.size(); i++) {
+        const sweepResult &r = results[i];
+        fprintf(file,"    {\"round_trip\": \"%s\", \"path\": \"%s\", \"ns_per_point\": %.3f, ",
+                r.roundTrip.c_str(),r.path.c_str(),r.nsPerPoint);
+        writeStats(file,"forward",r.forward,true);
+        fprintf(file,", ");
+        writeStats(file,"inverse",r.inverse,true);
+        fprintf(file,", ");
+        writeStats(file,"round_trip_error",r.roundTripError,true);
+        fprintf(file,"}%s\n",(i + 1 < results.size()) ? "," : "");
+    }
+    fprintf(file,"  ]\n}\n");
+}
+
+static void writeCSV(FILE *file, const std::vector<sweepResult> &results){
+    fprintf(file,"round_trip,path,ns_per_point");
+    const char *groups[] = {"forward", "inverse", "round_trip"};
+    for (int g = 0; g < 3; g++) {
+        fprintf(file,",%s_max,%s_p50,%s_p99,%s_p999",groups[g],groups[g],groups[g],groups[g]);
+    }
+    fprintf(file,"\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const sweepResult &r = results[i];
+        fprintf(file,"%s,%s,%.3f",r.roundTrip.c_str(),r.path.c_str(),r.nsPerPoint);
+        writeStats(file,"forward",r.forward,false);
+        writeStats(file,"inverse",r.inverse,false);
+        writeStats(file,"round_trip",r.roundTripError,false);
+        fprintf(file,"\n");
+    }
+}
+
+/***** main *******************************************************************/
+static int usage(const char *program){
+    fprintf(stderr,"Usage: %s [--format json|csv] [--points N] [--frames F] [--output FILE]\n",program);
+    return 1;
+}
+
+int main(int argc, char **argv){
+    std::string format = "json", outputName;
+    size_t count = 1000000, frameCount = 64;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            return usage(argv[0]);
+        } else if (!strcmp(argv[i],"--format")) {
+            format = argv[++i];
+        } else if (!strcmp(argv[i],"--points")) {
+            count = strtoul(argv[++i],NULL,10);
+        } else if (!strcmp(argv[i],"--frames")) {
+            frameCount = strtoul(argv[++i],NULL,10);
+        } else if (!strcmp(argv[i],"--output")) {
+            outputName = argv[++i];
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if ((format != "json" && format != "csv") || count == 0 || frameCount == 0) {
+        return usage(argv[0]);
+    }
+
+    sweepInputs inputs = makeInputs(count,frameCount);
+    std::vector<sweepPath> paths = geodeticPaths();
+    std::vector<sweepPath> local = localPaths();
+    paths.insert(paths.end(),local.begin(),local.end());
+    simdLevel saved = getSimdLevel();
+    std::vector<sweepResult> results;
+    std::string current;
+    std::vector<real> images;
+
+    for (size_t p = 0; p < paths.size(); p++) {
+        if (paths[p].roundTrip != current) {
+            current = paths[p].roundTrip;
+            images = referenceImages(current,inputs);
+        }
+        results.push_back(sweep(paths[p],inputs,images));
+        setSimdLevel(saved);
+    }
+
+    FILE *file = outputName.empty() ? stdout : fopen(outputName.c_str(),"w");
+    if (file == NULL) {
+        fprintf(stderr,"Cannot open %s\n",outputName.c_str());
+        return 1;
+    }
+    if (format == "json") {
+        writeJSON(file,results,inputs.count,inputs.frames.size());
+    } else {
+        writeCSV(file,results);
+    }
+    if (file != stdout) {
+        fclose(file);
+    }
+    return 0;
+}
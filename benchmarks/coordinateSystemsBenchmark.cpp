@@ -0,0 +1,425 @@
+/**
+ * @brief Conversion throughput benchmark.
+ * @file coordinateSystemsBenchmark.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Measures nanoseconds per point and points per second for every
+ * conversion of the library along the scalar class path, the batch path at
+ * each SIMD level and the multithreaded BatchEngine path, over input
+ * distributions that exercise the poles, the equator, high altitudes and
+ * points near a local frame origin. Results are written as JSON or CSV for
+ * regression tracking.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+/*
+ * Build with optimization together with every source file in src/, with
+ * include/ on the include path, and link the thread library.
+ *
+ * Usage: coordinateSystemsBenchmark [--format json|csv] [--points N]
+ *     [--repeats R] [--threads T] [--filter TEXT] [--output FILE]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "coordinateSystems.h"
+#include "localFrame.h"
+#include "batchConversions.h"
+#include "batchEngine.h"
+
+using namespace coordinateSystems;
+
+/***** inputs *****************************************************************/
+/*
+ * One input distribution: the same points expressed in every frame, stored
+ * as interleaved triples. Local frames share one origin and heading.
+ */
+struct dataset {
+    std::string name;
+    std::vector<double> ecf, lla, enu, dca, aer;
+};
+
+static const double originLatitude = 38.0;
+static const double originLongitude = -77.0;
+static const double originAltitude = 100.0;
+static const double originHeading = 30.0;
+
+static dataset makeDataset(const std::string &name, size_t count, LocalFrame &frame){
+    std::mt19937_64 generator(12345);
+    std::uniform_real_distribution<double> unit(0.0,1.0);
+    dataset data;
+    data.name = name;
+    data.lla.resize(3*count);
+    data.ecf.resize(3*count);
+    data.enu.resize(3*count);
+    data.dca.resize(3*count);
+    data.aer.resize(3*count);
+
+    for (size_t i = 0; i < count; i++) {
+        double latitude, longitude, altitude;
+        longitude = -180.0 + 360.0*unit(generator);
+        if (name == "poles") {
+            latitude = (i % 2 ? 1.0 : -1.0)*(90.0 - 0.1*unit(generator));
+            altitude = 20000.0*unit(generator);
+        } else if (name == "equator") {
+            latitude = -0.1 + 0.2*unit(generator);
+            altitude = 20000.0*unit(generator);
+        } else if (name == "high") {
+            latitude = asin(2.0*unit(generator) - 1.0)*180/PI;
+            altitude = 1.0e6 + 4.0e7*unit(generator);
+        } else if (name == "origin") {
+            //within a kilometre of the local frame origin
+            latitude = originLatitude + 0.01*(2.0*unit(generator) - 1.0);
+            longitude = originLongitude + 0.01*(2.0*unit(generator) - 1.0);
+            altitude = originAltitude + 1000.0*unit(generator);
+        } else {
+            //uniform over the surface, up to aircraft altitudes
+            latitude = asin(2.0*unit(generator) - 1.0)*180/PI;
+            altitude = -100.0 + 20000.0*unit(generator);
+        }
+        data.lla[3*i] = latitude;
+        data.lla[3*i+1] = longitude;
+        data.lla[3*i+2] = altitude;
+    }
+    llaToECF(count,&data.lla[0],&data.ecf[0]);
+    ecfToENU(count,&data.ecf[0],&data.enu[0],frame);
+    enuToDCA(count,&data.enu[0],&data.dca[0],frame);
+    dcaToAER(count,&data.dca[0],&data.aer[0]);
+    return data;
+}
+
+/***** cases ******************************************************************/
+typedef std::function<void(size_t, const double*, double*)> body;
+
+/*
+ * One benchmark: a conversion method along one path, reading one of the
+ * dataset frames.
+ */
+struct benchmarkCase {
+    std::string method;
+    std::string path;
+    std::string input;
+    body run;
+};
+
+struct result {
+    std::string method, path, simd, distribution;
+    double nsPerPoint, minNsPerPoint, pointsPerSecond;
+};
+
+static const char *simdName(simdLevel level){
+    switch (level) {
+        case SIMD_SSE2: return "sse2";
+        case SIMD_AVX2: return "avx2";
+        case SIMD_AVX512: return "avx512";
+        default: return "none";
+    }
+}
+
+static const std::vector<double> &inputOf(const dataset &data, const std::string &input){
+    if (input == "lla") return data.lla;
+    if (input == "enu") return data.enu;
+    if (input == "dca") return data.dca;
+    if (input == "aer") return data.aer;
+    return data.ecf;
+}
+
+/*
+ * Scalar path: one class conversion per point, as an application written
+ * against the original API would do it.
+ */
+static std::vector<benchmarkCase> scalarCases(LocalFrame &frame){
+    std::vector<benchmarkCase> cases;
+    LLA origin(originLatitude,originLongitude,originAltitude);
+    double heading = originHeading;
+
+#define SCALAR_CASE(method, input, expression) \
+    cases.push_back(benchmarkCase{method, "scalar", input, [=,&frame](size_t n, const double *in, double *out){ \
+        (void)frame; \
+        for (size_t i = 0; i < n; i++) { \
+            const double *p = in + 3*i; \
+            auto r = expression; \
+            out[3*i] = r.getFirstCoordinate(); \
+            out[3*i+1] = r.getSecondCoordinate(); \
+            out[3*i+2] = r.getThirdCoordinate(); \
+        } \
+    }})
+
+    SCALAR_CASE("ECF::toLLA", "ecf", ECF(p[0],p[1],p[2]).toLLA());
+    SCALAR_CASE("ECF::toLLA(GEODETIC_FIXED)", "ecf", ECF(p[0],p[1],p[2]).toLLA(GEODETIC_FIXED));
+    SCALAR_CASE("ECF::toLLA(GEODETIC_MILLIMETRE)", "ecf", ECF(p[0],p[1],p[2]).toLLA(GEODETIC_MILLIMETRE));
+    SCALAR_CASE("ECF::toLLA(GEODETIC_CLOSED_FORM)", "ecf", ECF(p[0],p[1],p[2]).toLLA(GEODETIC_CLOSED_FORM));
+    SCALAR_CASE("ECF::toENU", "ecf", ECF(p[0],p[1],p[2]).toENU(origin));
+    SCALAR_CASE("ECF::toDCA", "ecf", ECF(p[0],p[1],p[2]).toDCA(origin,heading));
+    SCALAR_CASE("ECF::toAER", "ecf", ECF(p[0],p[1],p[2]).toAER(origin,heading));
+    SCALAR_CASE("LLA::toECF", "lla", LLA(p[0],p[1],p[2]).toECF());
+    SCALAR_CASE("LLA::toENU", "lla", LLA(p[0],p[1],p[2]).toENU(origin));
+    SCALAR_CASE("LLA::toDCA", "lla", LLA(p[0],p[1],p[2]).toDCA(origin,heading));
+    SCALAR_CASE("LLA::toAER", "lla", LLA(p[0],p[1],p[2]).toAER(origin,heading));
+    SCALAR_CASE("ENU::toECF", "enu", ENU(p[0],p[1],p[2],origin).toECF());
+    SCALAR_CASE("ENU::toLLA", "enu", ENU(p[0],p[1],p[2],origin).toLLA());
+    SCALAR_CASE("ENU::toDCA", "enu", ENU(p[0],p[1],p[2],origin).toDCA(heading));
+    SCALAR_CASE("ENU::toAER", "enu", ENU(p[0],p[1],p[2],origin).toAER(heading));
+    SCALAR_CASE("DCA::toECF", "dca", DCA(p[0],p[1],p[2],origin,heading).toECF());
+    SCALAR_CASE("DCA::toLLA", "dca", DCA(p[0],p[1],p[2],origin,heading).toLLA());
+    SCALAR_CASE("DCA::toENU", "dca", DCA(p[0],p[1],p[2],origin,heading).toENU());
+    SCALAR_CASE("DCA::toAER", "dca", DCA(p[0],p[1],p[2],origin,heading).toAER());
+    SCALAR_CASE("AER::toECF", "aer", AER(p[0],p[1],p[2],origin,heading).toECF());
+    SCALAR_CASE("AER::toLLA", "aer", AER(p[0],p[1],p[2],origin,heading).toLLA());
+    SCALAR_CASE("AER::toENU", "aer", AER(p[0],p[1],p[2],origin,heading).toENU());
+    SCALAR_CASE("AER::toDCA", "aer", AER(p[0],p[1],p[2],origin,heading).toDCA());
+    SCALAR_CASE("LocalFrame::toENU", "ecf", frame.toENU(p[0],p[1],p[2]));
+    SCALAR_CASE("LocalFrame::toDCA", "ecf", frame.toDCA(p[0],p[1],p[2]));
+    SCALAR_CASE("LocalFrame::toAER", "ecf", frame.toAER(p[0],p[1],p[2]));
+    SCALAR_CASE("LocalFrame::toLLA(AER)", "aer", frame.toLLA(AER(p[0],p[1],p[2],origin,heading)));
+#undef SCALAR_CASE
+    return cases;
+}
+
+/*
+ * Batch path: one call per array, run once per SIMD level by the caller.
+ */
+static std::vector<benchmarkCase> batchCases(LocalFrame &frame){
+    std::vector<benchmarkCase> cases;
+    double heading = originHeading;
+
+#define BATCH_CASE(method, input, call) \
+    cases.push_back(benchmarkCase{method, "batch", input, [=,&frame](size_t n, const double *in, double *out){ \
+        (void)frame; (void)heading; \
+        call; \
+    }})
+
+    BATCH_CASE("ecfToLLA", "ecf", ecfToLLA(n,in,out));
+    BATCH_CASE("ecfToLLA<sphere>", "ecf", ecfToLLA<sphere>(n,in,out));
+    BATCH_CASE("llaToECF", "lla", llaToECF(n,in,out));
+    BATCH_CASE("ecfToENU", "ecf", ecfToENU(n,in,out,frame));
+    BATCH_CASE("enuToECF", "enu", enuToECF(n,in,out,frame));
+    BATCH_CASE("enuToDCA", "enu", enuToDCA(n,in,out,heading));
+    BATCH_CASE("dcaToENU", "dca", dcaToENU(n,in,out,heading));
+    BATCH_CASE("dcaToAER", "dca", dcaToAER(n,in,out));
+    BATCH_CASE("aerToDCA", "aer", aerToDCA(n,in,out));
+    BATCH_CASE("ecfToDCA", "ecf", ecfToDCA(n,in,out,frame));
+    BATCH_CASE("ecfToAER", "ecf", ecfToAER(n,in,out,frame));
+    BATCH_CASE("llaToENU", "lla", llaToENU(n,in,out,frame));
+    BATCH_CASE("llaToAER", "lla", llaToAER(n,in,out,frame));
+    BATCH_CASE("enuToLLA", "enu", enuToLLA(n,in,out,frame));
+    BATCH_CASE("enuToAER", "enu", enuToAER(n,in,out,frame));
+    BATCH_CASE("dcaToECF", "dca", dcaToECF(n,in,out,frame));
+    BATCH_CASE("dcaToLLA", "dca", dcaToLLA(n,in,out,frame));
+    BATCH_CASE("aerToENU", "aer", aerToENU(n,in,out,frame));
+    BATCH_CASE("aerToECF", "aer", aerToECF(n,in,out,frame));
+    BATCH_CASE("aerToLLA", "aer", aerToLLA(n,in,out,frame));
+#undef BATCH_CASE
+    return cases;
+}
+
+/*
+ * Parallel path: the heaviest batch conversions spread over a BatchEngine at
+ * the best SIMD level.
+ */
+static std::vector<benchmarkCase> parallelCases(LocalFrame &frame, BatchEngine &engine){
+    std::vector<benchmarkCase> cases;
+
+#define PARALLEL_CASE(method, input, call) \
+    cases.push_back(benchmarkCase{method, "parallel", input, [&frame,&engine](size_t n, const double *in, double *out){ \
+        (void)frame; \
+        call; \
+    }})
+
+    PARALLEL_CASE("ecfToLLA", "ecf", engine.run(n,in,out,(BatchEngine::conversion)ecfToLLA));
+    PARALLEL_CASE("llaToECF", "lla", engine.run(n,in,out,(BatchEngine::conversion)llaToECF));
+    PARALLEL_CASE("ecfToAER", "ecf", engine.run(n,in,out,(BatchEngine::frameConversion)ecfToAER,frame));
+    PARALLEL_CASE("llaToAER", "lla", engine.run(n,in,out,(BatchEngine::frameConversion)llaToAER,frame));
+    PARALLEL_CASE("aerToLLA", "aer", engine.run(n,in,out,(BatchEngine::frameConversion)aerToLLA,frame));
+#undef PARALLEL_CASE
+    return cases;
+}
+
+/***** measurement ************************************************************/
+static volatile double sink;
+
+/*
+ * Runs one case once untimed and then repeats times; reports the median and
+ * the fastest repetition.
+ */
+static result measure(const benchmarkCase &bench, const dataset &data, size_t count, int repeats,
+        std::vector<double> &output){
+    const std::vector<double> &input = inputOf(data,bench.input);
+    std::vector<double> times;
+
+    bench.run(count,&input[0],&output[0]);
+    for (int r = 0; r < repeats; r++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bench.run(count,&input[0],&output[0]);
+        std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double,std::nano>(stop - start).count()/count);
+        sink = sink + output[0] + output[3*count-1];
+    }
+    std::sort(times.begin(),times.end());
+
+    result measured;
+    measured.method = bench.method;
+    measured.path = bench.path;
+    measured.simd = (bench.path == "scalar") ? "none" : simdName(getSimdLevel());
+    measured.distribution = data.name;
+    measured.nsPerPoint = times[times.size()/2];
+    measured.minNsPerPoint = times[0];
+    measured.pointsPerSecond = 1.0e9/measured.nsPerPoint;
+    return measured;
+}
+
+/***** output *****************************************************************/
+static void writeJSON(FILE *file, const std::vector<result> &results, size_t count, int repeats, unsigned threads){
+    fprintf(file,"{\n");
+    fprintf(file,"  \"library_version\": \"26.10\",\n");
+    fprintf(file,"  \"points\": %zu,\n",count);
+    fprintf(file,"  \"repeats\": %d,\n",repeats);
+    fprintf(file,"  \"threads\": %u,\n",threads);
+    fprintf(file,"  \"simd_supported\": \"%s\",\n",simdName(getSupportedSimdLevel()));
+    fprintf(file,"  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const result &r = results[i];
+        fprintf(file,"    {\"method\": \"%s\", \"path\": \"%s\", \"simd\": \"%s\", \"distribution\": \"%s\", "
+                "\"ns_per_point\": %.3f, \"min_ns_per_point\": %.3f, \"points_per_second\": %.0f}%s\n",
+                r.method.c_str(),r.path.c_str(),r.simd.c_str(),r.distribution.c_str(),
+                r.nsPerPoint,r.minNsPerPoint,r.pointsPerSecond,(i + 1 < results.size()) ? "," : "");
+    }
+    fprintf(file,"  ]\n}\n");
+}
+
+static void writeCSV(FILE *file, const std::vector<result> &results){
+    fprintf(file,"method,path,simd,distribution,ns_per_point,min_ns_per_point,points_per_second\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const result &r = results[i];
+        fprintf(file,"\"%s\",%s,%s,%s,%.3f,%.3f,%.0f\n",r.method.c_str(),r.path.c_str(),r.simd.c_str(),
+                r.distribution.c_str(),r.nsPerPoint,r.minNsPerPoint,r.pointsPerSecond);
+    }
+}
+
+/***** main *******************************************************************/
+static int usage(const char *program){
+    fprintf(stderr,"Usage: %s [--format json|csv] [--points N] [--repeats R] [--threads T] "
+            "[--filter TEXT] [--output FILE]\n",program);
+    return 1;
+}
+
+int main(int argc, char **argv){
+    std::string format = "json", filter, outputName;
+    size_t count = 100000;
+    int repeats = 5;
+    unsigned threads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            return usage(argv[0]);
+        } else if (!strcmp(argv[i],"--format")) {
+            format = argv[++i];
+        } else if (!strcmp(argv[i],"--points")) {
+            count = strtoul(argv[++i],NULL,10);
+        } else if (!strcmp(argv[i],"--repeats")) {
+            repeats = atoi(argv[++i]);
+        } else if (!strcmp(argv[i],"--threads")) {
+            threads = strtoul(argv[++i],NULL,10);
+        } else if (!strcmp(argv[i],"--filter")) {
+            filter = argv[++i];
+        } else if (!strcmp(argv[i],"--output")) {
+            outputName = argv[++i];
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if ((format != "json" && format != "csv") || count == 0 || repeats < 1) {
+        return usage(argv[0]);
+    }
+
+    LocalFrame frame(originLatitude,originLongitude,originAltitude,originHeading);
+    BatchEngine engine(threads);
+    const char *distributions[] = {"uniform", "poles", "equator", "high", "origin"};
+    std::vector<double> output(3*count);
+    std::vector<result> results;
+    simdLevel saved = getSimdLevel();
+
+    std::vector<benchmarkCase> scalar = scalarCases(frame);
+    std::vector<benchmarkCase> batch = batchCases(frame);
+    std::vector<benchmarkCase> parallel = parallelCases(frame,engine);
+
+    for (int d = 0; d < 5; d++) {
+        dataset data = makeDataset(distributions[d],count,frame);
+        for (size_t i = 0; i < scalar.size(); i++) {
+            if (scalar[i].method.find(filter) != std::string::npos) {
+                results.push_back(measure(scalar[i],data,count,repeats,output));
+            }
+        }
+        for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+            setSimdLevel((simdLevel)level);
+            for (size_t i = 0; i < batch.size(); i++) {
+                if (batch[i].method.find(filter) != std::string::npos) {
+                    results.push_back(measure(batch[i],data,count,repeats,output));
+                }
+            }
+        }
+        setSimdLevel(saved);
+        for (size_t i = 0; i < parallel.size(); i++) {
+            if (parallel[i].method.find(filter) != std::string::npos) {
+                results.push_back(measure(parallel[i],data,count,repeats,output));
+            }
+        }
+    }
+
+    FILE *file = outputName.empty() ? stdout : fopen(outputName.c_str(),"w");
+    if (file == NULL) {
+        fprintf(stderr,"Cannot open %s\n",outputName.c_str());
+        return 1;
+    }
+    if (format == "json") {
+        writeJSON(file,results,count,repeats,engine.getThreadCount());
+    } else {
+        writeCSV(file,results);
+    }
+    if (file != stdout) {
+        fclose(file);
+    }
+    return 0;
+}
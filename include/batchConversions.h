@@ -0,0 +1,535 @@
+/**
+ * @brief Batch coordinate conversion definition.
+ * @file batchConversions.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Conversions between the coordinate systems of the class library
+ * applied to whole arrays of points held in caller-owned buffers, in either
+ * structure-of-arrays or strided array-of-structures layout. No per-point
+ * objects are constructed.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef BATCHCONVERSIONS_H
+#define	BATCHCONVERSIONS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "coordinateSystems.h"
+#include "localFrame.h"
+#include "frameTypes.h"
+
+namespace coordinateSystems {
+
+class BatchEngine; //forward declaration of class BatchEngine, see batchEngine.h
+
+/**
+ * @brief Writable view of an array of coordinate triples.
+ *
+ * Point i has its coordinates at first[i*stride], second[i*stride] and
+ * third[i*stride]. Separate arrays (structure-of-arrays) use a stride of 1;
+ * interleaved triples (array-of-structures) use a stride of 3, or the record
+ * size in doubles when the triples are embedded in larger records.
+*/
+class coordinateArray {
+public:
+/**
+ * @brief Structure-of-arrays (or general strided) constructor.
+ * @param _first: Pointer to the first coordinate of point 0.
+ * @param _second: Pointer to the second coordinate of point 0.
+ * @param _third: Pointer to the third coordinate of point 0.
+ * @param _stride: Distance in doubles between consecutive points (optional,
+ * default  = 1).
+ * @return class instance.
+ */
+    coordinateArray (double *_first, double *_second, double *_third, size_t _stride = 1);
+/**
+ * @brief Array-of-structures constructor.
+ * @param _interleaved: Pointer to consecutive {first, second, third} triples.
+ * @return class instance.
+ */
+    coordinateArray (double *_interleaved);
+/**
+ * @brief Array of value types constructor.
+ * @param _values: Pointer to consecutive Vec3 values of any frame.
+ * @return class instance.
+ */
+    template <class FrameTag>
+    coordinateArray (Vec3<FrameTag> *_values) : first(&_values->first), second(&_values->second),
+    third(&_values->third), stride(3) {}
+    double *first, *second, *third;
+    size_t stride;
+};
+
+/**
+ * @brief Read-only view of an array of coordinate triples.
+ *
+ * Same layout rules as coordinateArray.
+*/
+class constCoordinateArray {
+public:
+/**
+ * @brief Structure-of-arrays (or general strided) constructor.
+ * @param _first: Pointer to the first coordinate of point 0.
+ * @param _second: Pointer to the second coordinate of point 0.
+ * @param _third: Pointer to the third coordinate of point 0.
+ * @param _stride: Distance in doubles between consecutive points (optional,
+ * default  = 1).
+ * @return class instance.
+ */
+    constCoordinateArray (const double *_first, const double *_second, const double *_third, size_t _stride = 1);
+/**
+ * @brief Array-of-structures constructor.
+ * @param _interleaved: Pointer to consecutive {first, second, third} triples.
+ * @return class instance.
+ */
+    constCoordinateArray (const double *_interleaved);
+/**
+ * @brief Array of value types constructor.
+ * @param _values: Pointer to consecutive Vec3 values of any frame.
+ * @return class instance.
+ */
+    template <class FrameTag>
+    constCoordinateArray (const Vec3<FrameTag> *_values) : first(&_values->first), second(&_values->second),
+    third(&_values->third), stride(3) {}
+/**
+ * @brief Read-only view of a writable array.
+ * @param _array: Array to view.
+ * @return class instance.
+ */
+    constCoordinateArray (const coordinateArray &_array);
+    const double *first, *second, *third;
+    size_t stride;
+};
+
+/**
+ * @brief Instruction sets available to the batch kernels.
+ */
+enum simdLevel {
+    SIMD_NONE = 0, //portable scalar code
+    SIMD_SSE2 = 1, //2 doubles per instruction
+    SIMD_AVX2 = 2, //4 doubles per instruction, with FMA
+    SIMD_AVX512 = 3 //8 doubles per instruction
+};
+
+/**
+ * @brief Gets the best instruction set supported by the processor.
+ * @return Supported SIMD level.
+ */
+simdLevel getSupportedSimdLevel(void);
+/**
+ * @brief Gets the instruction set used by the batch kernels.
+ * @return SIMD level in use (defaults to the supported level).
+ */
+simdLevel getSimdLevel(void);
+/**
+ * @brief Sets the instruction set used by the batch kernels.
+ * @param _level: Requested SIMD level, lowered to the supported level if
+ * necessary.
+ * @return Nothing.
+ *
+ * Intended for testing and benchmarking; not synchronized with conversions
+ * running on other threads.
+ */
+void setSimdLevel(simdLevel _level);
+
+/*
+ * Every conversion reads _count points from _in and writes _count points to
+ * _out. _in and _out may describe the same storage for in-place conversion,
+ * but must not otherwise overlap. Units and conventions follow the class
+ * library: angles in degrees, distances in meters, headings from True North.
+ *
+ * Conversions spanning several systems (ECF/LLA to DCA/AER and back, and ENU
+ * to and from AER) are fused: the ENU and heading rotations are combined into
+ * one matrix and each point goes from input to output in a single vectorized
+ * pass, with the same special cases as the classes (zero azimuth and elevation
+ * for the zero vector, zero azimuth for vertical vectors).
+ */
+
+/**
+ * @brief Batch conversion from ECF to LLA.
+ * @param _count: Number of points.
+ * @param _in: ECF points.
+ * @param _out: Receives LLA points.
+ * @return Nothing.
+ *
+ * Uses the non-iterative Vermeille solution, vectorized at the current SIMD
+ * level. Unlike ECF::toLLA it has no latitude tolerance: results agree with
+ * the exact geodetic coordinates to well under a millimetre for points more
+ * than about 50 km from the centre of the Earth. Angles are converted with
+ * full precision, consistently with llaToECF.
+ */
+void ecfToLLA(size_t _count, constCoordinateArray _in, coordinateArray _out);
+/**
+ * @brief Batch conversion from ECF to LLA on a given ellipsoid.
+ * @param _count: Number of points.
+ * @param _in: ECF points.
+ * @param _out: Receives LLA points.
+ * @param _a: Ellipsoid semi-major axis in meters.
+ * @param _e2: Ellipsoid eccentricity squared; zero selects the spherical
+ * formulas, which need no geodetic solver.
+ * @return Nothing.
+ */
+void ecfToLLA(size_t _count, constCoordinateArray _in, coordinateArray _out, double _a, double _e2);
+/**
+ * @brief Batch conversion from ECF to LLA on a compile-time ellipsoid.
+ * @tparam Ellipsoid: An ellipsoid policy such as WGS84, GRS80 or sphere.
+ * @param _count: Number of points.
+ * @param _in: ECF points.
+ * @param _out: Receives LLA points.
+ * @return Nothing.
+ */
+template <class Ellipsoid>
+inline void ecfToLLA(size_t _count, constCoordinateArray _in, coordinateArray _out){
+    ecfToLLA(_count,_in,_out,Ellipsoid::a,Ellipsoid::e2);
+}
+/**
+ * @brief Batch conversion from LLA to ECF.
+ * @param _count: Number of points.
+ * @param _in: LLA points.
+ * @param _out: Receives ECF points.
+ * @return Nothing.
+ *
+ * Vectorized at the current SIMD level, with one sine/cosine evaluation per
+ * angle. Angles are converted with full precision rather than the 12 digit PI
+ * macro, so results can differ from LLA::toECF by a few micrometres.
+ */
+void llaToECF(size_t _count, constCoordinateArray _in, coordinateArray _out);
+/**
+ * @brief Batch conversion from LLA to ECF on a given ellipsoid.
+ * @param _count: Number of points.
+ * @param _in: LLA points.
+ * @param _out: Receives ECF points.
+ * @param _a: Ellipsoid semi-major axis in meters.
+ * @param _e2: Ellipsoid eccentricity squared; zero selects the spherical
+ * formulas.
+ * @return Nothing.
+ */
+void llaToECF(size_t _count, constCoordinateArray _in, coordinateArray _out, double _a, double _e2);
+/**
+ * @brief Batch conversion from LLA to ECF on a compile-time ellipsoid.
+ * @tparam Ellipsoid: An ellipsoid policy such as WGS84, GRS80 or sphere.
+ * @param _count: Number of points.
+ * @param _in: LLA points.
+ * @param _out: Receives ECF points.
+ * @return Nothing.
+ */
+template <class Ellipsoid>
+inline void llaToECF(size_t _count, constCoordinateArray _in, coordinateArray _out){
+    llaToECF(_count,_in,_out,Ellipsoid::a,Ellipsoid::e2);
+}
+/**
+ * @brief Batch conversion from ECF to ENU.
+ * @param _count: Number of points.
+ * @param _in: ECF points.
+ * @param _out: Receives ENU points.
+ * @param _frame: Frame defining the ENU origin.
+ * @return Nothing.
+ */
+void ecfToENU(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from ENU to ECF.
+ * @param _count: Number of points.
+ * @param _in: ENU points.
+ * @param _out: Receives ECF points.
+ * @param _frame: Frame defining the ENU origin.
+ * @return Nothing.
+ */
+void enuToECF(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from ENU to DCA.
+ * @param _count: Number of points.
+ * @param _in: ENU points.
+ * @param _out: Receives DCA points.
+ * @param _heading: Heading of the DCA frame measured from True North in degrees.
+ * @return Nothing.
+ */
+void enuToDCA(size_t _count, constCoordinateArray _in, coordinateArray _out, double _heading);
+/**
+ * @brief Batch conversion from DCA to ENU.
+ * @param _count: Number of points.
+ * @param _in: DCA points.
+ * @param _out: Receives ENU points.
+ * @param _heading: Heading of the DCA frame measured from True North in degrees.
+ * @return Nothing.
+ */
+void dcaToENU(size_t _count, constCoordinateArray _in, coordinateArray _out, double _heading);
+/**
+ * @brief Batch conversion from ENU to DCA with the cached heading rotation of
+ * a frame.
+ * @param _count: Number of points.
+ * @param _in: ENU points.
+ * @param _out: Receives DCA points.
+ * @param _frame: Frame defining the DCA heading.
+ * @return Nothing.
+ */
+void enuToDCA(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from DCA to ENU with the cached heading rotation of
+ * a frame.
+ * @param _count: Number of points.
+ * @param _in: DCA points.
+ * @param _out: Receives ENU points.
+ * @param _frame: Frame defining the DCA heading.
+ * @return Nothing.
+ */
+void dcaToENU(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from DCA to AER.
+ * @param _count: Number of points.
+ * @param _in: DCA points.
+ * @param _out: Receives AER points.
+ * @return Nothing.
+ */
+void dcaToAER(size_t _count, constCoordinateArray _in, coordinateArray _out);
+/**
+ * @brief Batch conversion from AER to DCA.
+ * @param _count: Number of points.
+ * @param _in: AER points.
+ * @param _out: Receives DCA points.
+ * @return Nothing.
+ */
+void aerToDCA(size_t _count, constCoordinateArray _in, coordinateArray _out);
+/**
+ * @brief Batch conversion from ECF to DCA.
+ * @param _count: Number of points.
+ * @param _in: ECF points.
+ * @param _out: Receives DCA points.
+ * @param _frame: Frame defining the DCA origin and heading.
+ * @return Nothing.
+ */
+void ecfToDCA(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from ECF to AER.
+ * @param _count: Number of points.
+ * @param _in: ECF points.
+ * @param _out: Receives AER points.
+ * @param _frame: Frame defining the AER origin and heading.
+ * @return Nothing.
+ */
+void ecfToAER(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from LLA to ENU.
+ * @param _count: Number of points.
+ * @param _in: LLA points.
+ * @param _out: Receives ENU points.
+ * @param _frame: Frame defining the ENU origin.
+ * @return Nothing.
+ */
+void llaToENU(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from LLA to DCA.
+ * @param _count: Number of points.
+ * @param _in: LLA points.
+ * @param _out: Receives DCA points.
+ * @param _frame: Frame defining the DCA origin and heading.
+ * @return Nothing.
+ */
+void llaToDCA(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from LLA to AER.
+ * @param _count: Number of points.
+ * @param _in: LLA points.
+ * @param _out: Receives AER points.
+ * @param _frame: Frame defining the AER origin and heading.
+ * @return Nothing.
+ */
+void llaToAER(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from ENU to LLA.
+ * @param _count: Number of points.
+ * @param _in: ENU points.
+ * @param _out: Receives LLA points.
+ * @param _frame: Frame defining the ENU origin.
+ * @return Nothing.
+ */
+void enuToLLA(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from ENU to AER.
+ * @param _count: Number of points.
+ * @param _in: ENU points.
+ * @param _out: Receives AER points.
+ * @param _heading: Heading of the AER frame measured from True North in degrees.
+ * @return Nothing.
+ */
+void enuToAER(size_t _count, constCoordinateArray _in, coordinateArray _out, double _heading);
+/**
+ * @brief Batch conversion from ENU to AER with the cached heading rotation of
+ * a frame.
+ * @param _count: Number of points.
+ * @param _in: ENU points.
+ * @param _out: Receives AER points.
+ * @param _frame: Frame defining the AER heading.
+ * @return Nothing.
+ */
+void enuToAER(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from DCA to ECF.
+ * @param _count: Number of points.
+ * @param _in: DCA points.
+ * @param _out: Receives ECF points.
+ * @param _frame: Frame defining the DCA origin and heading.
+ * @return Nothing.
+ */
+void dcaToECF(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from DCA to LLA.
+ * @param _count: Number of points.
+ * @param _in: DCA points.
+ * @param _out: Receives LLA points.
+ * @param _frame: Frame defining the DCA origin and heading.
+ * @return Nothing.
+ */
+void dcaToLLA(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from AER to ENU.
+ * @param _count: Number of points.
+ * @param _in: AER points.
+ * @param _out: Receives ENU points.
+ * @param _heading: Heading of the AER frame measured from True North in degrees.
+ * @return Nothing.
+ */
+void aerToENU(size_t _count, constCoordinateArray _in, coordinateArray _out, double _heading);
+/**
+ * @brief Batch conversion from AER to ENU with the cached heading rotation of
+ * a frame.
+ * @param _count: Number of points.
+ * @param _in: AER points.
+ * @param _out: Receives ENU points.
+ * @param _frame: Frame defining the AER heading.
+ * @return Nothing.
+ */
+void aerToENU(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from AER to ECF.
+ * @param _count: Number of points.
+ * @param _in: AER points.
+ * @param _out: Receives ECF points.
+ * @param _frame: Frame defining the AER origin and heading.
+ * @return Nothing.
+ */
+void aerToECF(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+/**
+ * @brief Batch conversion from AER to LLA.
+ * @param _count: Number of points.
+ * @param _in: AER points.
+ * @param _out: Receives LLA points.
+ * @param _frame: Frame defining the AER origin and heading.
+ * @return Nothing.
+ */
+void aerToLLA(size_t _count, constCoordinateArray _in, coordinateArray _out, LocalFrame &_frame);
+
+/*
+ * Look-angle matrices: AER of every target from every sensor. Targets are
+ * converted to ECF once and the sensor frame constants are built once; the
+ * targets are then swept in blocks small enough to stay in the L1 cache
+ * while every sensor converts them with the fused SIMD kernel, and blocks
+ * are spread over the threads of a BatchEngine if one is given. Element
+ * (sensor s, target t) is output point s*_targetCount + t, so each sensor
+ * fills one row.
+ */
+static const size_t lookAngleBlock = 512; //targets per cache block
+
+/**
+ * @brief AER of ECF targets from each of a set of sensor frames.
+ * @param _sensorCount: Number of sensors.
+ * @param _sensors: Sensor frames (origin and heading).
+ * @param _targetCount: Number of targets.
+ * @param _targets: ECF targets.
+ * @param _out: Receives _sensorCount*_targetCount AER points, sensor-major.
+ * @param _engine: Engine spreading the target blocks across threads
+ * (optional, default = NULL, compute on the calling thread).
+ * @return Nothing.
+ */
+void ecfToAERMatrix(size_t _sensorCount, LocalFrame *_sensors, size_t _targetCount, constCoordinateArray _targets,
+        coordinateArray _out, BatchEngine *_engine = NULL);
+/**
+ * @brief AER of LLA targets from each of a set of sensor frames.
+ * @param _sensorCount: Number of sensors.
+ * @param _sensors: Sensor frames (origin and heading).
+ * @param _targetCount: Number of targets.
+ * @param _targets: LLA targets, converted to ECF once.
+ * @param _out: Receives _sensorCount*_targetCount AER points, sensor-major.
+ * @param _engine: Engine spreading the work across threads (optional,
+ * default = NULL, compute on the calling thread).
+ * @return Nothing.
+ */
+void llaToAERMatrix(size_t _sensorCount, LocalFrame *_sensors, size_t _targetCount, constCoordinateArray _targets,
+        coordinateArray _out, BatchEngine *_engine = NULL);
+
+/*
+ * Visibility pre-filters: which ECF targets a sensor sees above an elevation
+ * mask and within a maximum range, as a bit array of (_count+63)/64 words in
+ * which bit i%64 of word i/64 is set for target i. The elevation test is
+ * above >= range*sin(mask) on the DCA offsets, vectorized at the current SIMD
+ * level, so no arctangent is evaluated for a target outside the range or
+ * below the lowest mask elevation, nor for one above the highest. Only the
+ * targets in between have their azimuth computed to look up their sector.
+ * The results agree with the elevations of ecfToAER up to rounding at the
+ * mask itself.
+ */
+
+/**
+ * @brief Visibility of ECF targets above a uniform elevation mask.
+ * @param _count: Number of targets.
+ * @param _targets: ECF targets.
+ * @param _sensor: Sensor frame (origin and heading).
+ * @param _elevation: Mask elevation in degrees.
+ * @param _maxRange: Maximum range in meters.
+ * @param _visible: Receives the visibility bits, (_count+63)/64 words.
+ * @return Number of visible targets.
+ */
+size_t ecfVisibility(size_t _count, constCoordinateArray _targets, LocalFrame &_sensor, double _elevation, double _maxRange,
+        uint64_t *_visible);
+/**
+ * @brief Visibility of ECF targets above an azimuth-dependent elevation mask.
+ * @param _count: Number of targets.
+ * @param _targets: ECF targets.
+ * @param _sensor: Sensor frame (origin and heading).
+ * @param _sectorCount: Number of azimuth sectors.
+ * @param _elevations: Mask elevation in degrees of each sector; sector k
+ * covers the AER azimuths from k*360/_sectorCount (inclusive) to
+ * (k+1)*360/_sectorCount degrees, clockwise from the sensor heading.
+ * @param _maxRange: Maximum range in meters.
+ * @param _visible: Receives the visibility bits, (_count+63)/64 words.
+ * @return Number of visible targets.
+ * @throw std::runtime_error if there are no sectors.
+ */
+size_t ecfVisibility(size_t _count, constCoordinateArray _targets, LocalFrame &_sensor, size_t _sectorCount,
+        const double *_elevations, double _maxRange, uint64_t *_visible);
+}
+#endif	/* BATCHCONVERSIONS_H */
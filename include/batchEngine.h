@@ -0,0 +1,164 @@
+/**
+ * @brief Parallel batch engine class definition.
+ * @file batchEngine.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Thread pool that splits batch conversions into fixed chunks and
+ * balances them across threads by work stealing.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef BATCHENGINE_H
+#define	BATCHENGINE_H
+
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "batchConversions.h"
+
+namespace coordinateSystems {
+
+/**
+ * @brief Thread pool running batch conversions in parallel.
+ *
+ * A batch is cut into chunks of a fixed number of points. Each thread starts
+ * on its own contiguous share of the chunks and, once that is exhausted,
+ * steals chunks from the back of the other shares, so uneven chunks do not
+ * leave threads idle. Chunk boundaries depend only on the batch size and the
+ * chunk size, and every chunk writes the same output elements it would in a
+ * serial call, so the output is identical to the serial conversion whatever
+ * the thread count or scheduling.
+ *
+ * The calling thread takes part in every run; an engine limited to one
+ * thread runs conversions inline without creating threads. Runs on the same
+ * engine from several threads are serialized.
+*/
+class BatchEngine {
+public:
+    typedef void (*conversion)(size_t, constCoordinateArray, coordinateArray);
+    typedef void (*frameConversion)(size_t, constCoordinateArray, coordinateArray, LocalFrame&);
+    typedef void (*headingConversion)(size_t, constCoordinateArray, coordinateArray, double);
+/**
+ * @brief Batch engine constructor.
+ * @param _maxThreads: Maximum number of threads working on a batch, including
+ * the calling thread (optional, default  = 0, one per hardware thread).
+ * @param _chunkSize: Number of points per chunk (optional, default  = 4096).
+ * @return class instance.
+ */
+    BatchEngine (unsigned _maxThreads = 0, size_t _chunkSize = 4096);
+    ~BatchEngine();
+    BatchEngine (const BatchEngine&) = delete;
+    BatchEngine &operator=(const BatchEngine&) = delete;
+/**
+ * @brief Gets the number of threads working on a batch.
+ * @return Thread count, including the calling thread.
+ */
+    unsigned getThreadCount(void);
+/**
+ * @brief Gets the number of points per chunk.
+ * @return Chunk size.
+ */
+    size_t getChunkSize(void);
+/**
+ * @brief Runs a batch conversion in parallel.
+ * @param _count: Number of points.
+ * @param _in: Input points.
+ * @param _out: Receives output points; may be the input array.
+ * @param _conversion: Batch conversion, e.g. ecfToLLA.
+ * @return Nothing.
+ */
+    void run(size_t _count, constCoordinateArray _in, coordinateArray _out, conversion _conversion);
+/**
+ * @brief Runs a batch conversion against a local frame in parallel.
+ * @param _count: Number of points.
+ * @param _in: Input points.
+ * @param _out: Receives output points; may be the input array.
+ * @param _conversion: Batch conversion, e.g. ecfToAER.
+ * @param _frame: Local frame shared read-only by all threads.
+ * @return Nothing.
+ */
+    void run(size_t _count, constCoordinateArray _in, coordinateArray _out, frameConversion _conversion, LocalFrame &_frame);
+/**
+ * @brief Runs a batch conversion between local frames in parallel.
+ * @param _count: Number of points.
+ * @param _in: Input points.
+ * @param _out: Receives output points; may be the input array.
+ * @param _conversion: Batch conversion, e.g. enuToDCA.
+ * @param _heading: Heading of the DCA/AER axes in degrees.
+ * @return Nothing.
+ */
+    void run(size_t _count, constCoordinateArray _in, coordinateArray _out, headingConversion _conversion, double _heading);
+/**
+ * @brief Runs a task over a range of points in parallel.
+ * @param _count: Number of points.
+ * @param _task: Called with disjoint [begin, end) point ranges covering
+ * [0, _count), possibly from several threads at once.
+ * @return Nothing.
+ *
+ * The first exception thrown by the task is rethrown here once all threads
+ * have stopped.
+ */
+    void run(size_t _count, const std::function<void(size_t, size_t)> &_task);
+private:
+    struct chunkQueue {
+        std::mutex lock;
+        size_t begin, end; //chunk indices not yet taken
+    };
+    size_t chunkSize;
+    std::vector<std::thread> threads;
+    std::vector<chunkQueue> queues; //one per thread, the caller uses queue 0
+    std::mutex runLock; //serializes runs
+    std::mutex lock; //guards the members below
+    std::condition_variable wake, done;
+    std::function<void(size_t, size_t)> task;
+    size_t taskCount;
+    unsigned generation; //incremented for every run
+    unsigned active; //worker threads inside a run
+    bool stopping;
+    std::atomic<size_t> remaining; //chunks not yet finished
+    std::exception_ptr error;
+    void workerLoop(unsigned _index);
+    bool takeChunk(unsigned _index, size_t &_chunk);
+    void execute(unsigned _index);
+};
+}
+#endif	/* BATCHENGINE_H */
@@ -0,0 +1,158 @@
+/**
+ * @brief Memory-mapped bulk conversion definition.
+ * @file bulkConversions.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Converts flat binary files of coordinate triples through the batch
+ * kernels by memory-mapping them, either in place or into a mapped output
+ * file, in cache-sized chunks with sequential and read-ahead hints, so no
+ * parsing, intermediate copies or per-point objects are needed.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef BULKCONVERSIONS_H
+#define	BULKCONVERSIONS_H
+
+#include <stddef.h>
+#include <string>
+#include "batchConversions.h"
+#include "batchEngine.h"
+
+namespace coordinateSystems {
+
+/*
+ * Bulk file conversions. A point file is a flat array of interleaved
+ * {first, second, third} doubles in the native byte order, with no header,
+ * e.g. ECF triples in meters or LLA triples in degrees and meters, so its
+ * size must be a multiple of 24 bytes. The input is memory-mapped and
+ * converted chunk by chunk through the batch conversions; the output is
+ * either the input file itself or a new file of the same size, also
+ * memory-mapped. Each chunk of points (bulkChunkPoints by default, about
+ * 200 KB of input, a size that stays in the L2 cache with its output) is
+ * converted once its pages are requested with a read-ahead hint, and input
+ * pages already converted are released so tens of GB can stream through
+ * without filling memory.
+ *
+ * With a BatchEngine, each chunk is split across the engine threads; chunks
+ * are enlarged if needed so that every thread gets at least one engine chunk.
+ *
+ * Uses POSIX mmap, madvise and posix_fallocate. Errors (missing file, file
+ * size not a multiple of 24 bytes, failed mapping, no space for the output,
+ * failed write-back) throw std::runtime_error, and an output file created by
+ * the call is removed.
+ */
+
+static const size_t bulkChunkPoints = 8192; //default points per chunk
+
+/**
+ * @brief Converts a point file into a new point file.
+ * @param _input: Path of the input point file.
+ * @param _output: Path of the output point file, created or truncated; if it
+ * names the input file, the input is converted in place.
+ * @param _conversion: Batch conversion, e.g. ecfToLLA.
+ * @param _engine: Engine splitting each chunk across threads (optional,
+ * default = NULL, convert on the calling thread).
+ * @param _chunkPoints: Points per chunk (optional, default = bulkChunkPoints).
+ * @return Number of points converted.
+ */
+size_t convertFile(const std::string &_input, const std::string &_output, BatchEngine::conversion _conversion,
+        BatchEngine *_engine = NULL, size_t _chunkPoints = bulkChunkPoints);
+/**
+ * @brief Converts a point file into a new point file against a local frame.
+ * @param _input: Path of the input point file.
+ * @param _output: Path of the output point file, created or truncated; if it
+ * names the input file, the input is converted in place.
+ * @param _conversion: Batch conversion, e.g. ecfToAER.
+ * @param _frame: Local frame.
+ * @param _engine: Engine splitting each chunk across threads (optional,
+ * default = NULL, convert on the calling thread).
+ * @param _chunkPoints: Points per chunk (optional, default = bulkChunkPoints).
+ * @return Number of points converted.
+ */
+size_t convertFile(const std::string &_input, const std::string &_output, BatchEngine::frameConversion _conversion,
+        LocalFrame &_frame, BatchEngine *_engine = NULL, size_t _chunkPoints = bulkChunkPoints);
+/**
+ * @brief Converts a point file into a new point file between local frames.
+ * @param _input: Path of the input point file.
+ * @param _output: Path of the output point file, created or truncated; if it
+ * names the input file, the input is converted in place.
+ * @param _conversion: Batch conversion, e.g. enuToDCA.
+ * @param _heading: Heading of the DCA/AER axes in degrees.
+ * @param _engine: Engine splitting each chunk across threads (optional,
+ * default = NULL, convert on the calling thread).
+ * @param _chunkPoints: Points per chunk (optional, default = bulkChunkPoints).
+ * @return Number of points converted.
+ */
+size_t convertFile(const std::string &_input, const std::string &_output, BatchEngine::headingConversion _conversion,
+        double _heading, BatchEngine *_engine = NULL, size_t _chunkPoints = bulkChunkPoints);
+/**
+ * @brief Converts a point file in place.
+ * @param _path: Path of the point file, overwritten with the results.
+ * @param _conversion: Batch conversion, e.g. ecfToLLA.
+ * @param _engine: Engine splitting each chunk across threads (optional,
+ * default = NULL, convert on the calling thread).
+ * @param _chunkPoints: Points per chunk (optional, default = bulkChunkPoints).
+ * @return Number of points converted.
+ */
+size_t convertFile(const std::string &_path, BatchEngine::conversion _conversion,
+        BatchEngine *_engine = NULL, size_t _chunkPoints = bulkChunkPoints);
+/**
+ * @brief Converts a point file in place against a local frame.
+ * @param _path: Path of the point file, overwritten with the results.
+ * @param _conversion: Batch conversion, e.g. ecfToAER.
+ * @param _frame: Local frame.
+ * @param _engine: Engine splitting each chunk across threads (optional,
+ * default = NULL, convert on the calling thread).
+ * @param _chunkPoints: Points per chunk (optional, default = bulkChunkPoints).
+ * @return Number of points converted.
+ */
+size_t convertFile(const std::string &_path, BatchEngine::frameConversion _conversion,
+        LocalFrame &_frame, BatchEngine *_engine = NULL, size_t _chunkPoints = bulkChunkPoints);
+/**
+ * @brief Converts a point file in place between local frames.
+ * @param _path: Path of the point file, overwritten with the results.
+ * @param _conversion: Batch conversion, e.g. enuToDCA.
+ * @param _heading: Heading of the DCA/AER axes in degrees.
+ * @param _engine: Engine splitting each chunk across threads (optional,
+ * default = NULL, convert on the calling thread).
+ * @param _chunkPoints: Points per chunk (optional, default = bulkChunkPoints).
+ * @return Number of points converted.
+ */
+size_t convertFile(const std::string &_path, BatchEngine::headingConversion _conversion,
+        double _heading, BatchEngine *_engine = NULL, size_t _chunkPoints = bulkChunkPoints);
+}
+#endif	/* BULKCONVERSIONS_H */
@@ -0,0 +1,472 @@
+/**
+ * @brief Scalar-type templated conversion formulas.
+ * @file conversionKernels.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details The geodetic and local frame conversion formulas written once as
+ * templates over the scalar type. The same code runs in float for high rate
+ * display paths, in double for production, in long double for reference
+ * checks, and on the double SIMD pack types inside the batch conversions.
+ * Angles are in degrees and distances in meters throughout.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef CONVERSIONKERNELS_H
+#define	CONVERSIONKERNELS_H
+
+#include <math.h>
+#include "ellipsoid.h"
+
+/*
+ * coordinateSystems.h does not include this header on purpose: the SIMD
+ * kernel translation units must first see these templates after their target
+ * pragma, or the pack instantiations are compiled for the baseline ISA.
+ */
+
+namespace coordinateSystems {
+namespace kernels {
+
+/*
+ * Measured worst-case error of the float and double instantiations against
+ * long double, over 200,000 random points: all latitudes and longitudes,
+ * altitudes from -10 km to 10 km (surface) and up to 40,000 km (GEO), local
+ * vectors and ranges up to 1000 km. Angles in degrees, lengths in meters.
+ *
+ *                          float                double
+ * ecfToLLAClosedForm  angle  2e-5                 3e-14
+ *                     alt    2 (surface), 9 (GEO) 3e-9 (surface), 2e-8 (GEO)
+ * llaToECFSinCos      xyz    1.6 (surface), 11    3e-9 (surface), 2e-8 (GEO)
+ * dcaToAERPolar       angle  2e-5                 4e-14
+ *                     range  0.16                 3e-10
+ * aerToDCAPolar       dca    0.17                 3e-10
+ * enuRotation and
+ * rotateToLocal       local  1.5 (surface), 11    3e-9 (surface), 2e-8 (GEO)
+ *
+ * The pack types run the double formulas lane by lane with their own atan2,
+ * cbrt and sincosDegrees and measured the same bounds as double. The float
+ * errors are a few units of the float spacing of the outputs (8e-6 degrees
+ * at 90 degrees, 0.5 m at the Earth's radius): fine for display, not for
+ * geodesy.
+ */
+
+/*
+ * Full precision angle conversions. The PI macro in coordinateSystems.h is
+ * rounded to 12 digits; the kernels convert in both directions with these so
+ * that batch round trips stay consistent to the last bit.
+ */
+const double degPerRad = 57.295779513082320876798;
+const double radPerDeg = 0.017453292519943295769237;
+
+/**
+ * @brief Radians to degrees in the precision of the scalar type.
+ */
+template <class T>
+inline T toDegrees(T _radians){
+    return _radians*T(57.295779513082320876798L);
+}
+
+/**
+ * @brief Degrees to radians in the precision of the scalar type.
+ */
+template <class T>
+inline T toRadians(T _degrees){
+    return _degrees*T(0.017453292519943295769237L);
+}
+
+/**
+ * @brief Scalar lane select, counterpart of the pack select overloads.
+ * @param _mask: Condition.
+ * @param _a: Value returned where the condition holds.
+ * @param _b: Value returned otherwise.
+ * @return _a or _b.
+ */
+template <class T>
+inline T select(bool _mask, T _a, T _b){
+    return _mask ? _a : _b;
+}
+
+/**
+ * @brief Sine and cosine of an angle in degrees, for double packs or scalars.
+ * @param x: Angle in degrees.
+ * @param sine, cosine: Receive the results.
+ *
+ * The angle is reduced to [-45, 45] degrees by subtracting the nearest
+ * multiple of 90, which is exact in floating point, so there is no range
+ * reduction error for any latitude or longitude. Sine and cosine then share
+ * the same polynomial argument (Cephes coefficients, about 1 ulp) and the
+ * quadrant only swaps and negates them. The rounding constant and the
+ * polynomials are for double; float and long double use the overloads below.
+ */
+template <class P>
+inline void sincosDegrees(P x, P &sine, P &cosine){
+    using ::fabs;
+    const double ROUND = 6755399441055744.0; //1.5*2^52, adding it rounds to an integer
+    P q = (x*(1.0/90.0) + ROUND) - ROUND;
+    P r = (x - q*90.0)*radPerDeg;
+    P z = r*r;
+    P s = ((((((1.58962301576546568060E-10*z - 2.50507477628578072866E-8)*z
+        + 2.75573136213857245213E-6)*z - 1.98412698295895385996E-4)*z
+        + 8.33333333332211858878E-3)*z - 1.66666666666666307295E-1)*z)*r + r;
+    P c = ((((((-1.13585365213876817300E-11*z + 2.08757008419747316778E-9)*z
+        - 2.75573141792967388112E-7)*z + 2.48015872888517045348E-5)*z
+        - 1.38888888888730564116E-3)*z + 4.16666666666665929218E-2)*z)*z
+        - 0.5*z + 1.0;
+    //quadrant in -2..2
+    P m = q - 4.0*((q*0.25 + ROUND) - ROUND);
+    P am = fabs(m);
+    sine = select(am == P(1.0), c, s);
+    cosine = select(am == P(1.0), s, c);
+    sine = select((m < P(0.0)) | (m > P(1.5)), -sine, sine);
+    cosine = select((m > P(0.5)) | (m < P(-1.5)), -cosine, cosine);
+}
+
+/**
+ * @brief Sine and cosine in degrees through math.h, for scalar types other
+ * than double.
+ *
+ * remquo reduces by 90 degrees exactly and returns the quadrant, so the
+ * result is as accurate as sin and cos in the scalar type.
+ */
+template <class T>
+inline void sincosDegreesLibm(T x, T &sine, T &cosine){
+    using ::remquo;
+    using ::sin;
+    using ::cos;
+    int quadrant;
+    T r = toRadians(remquo(x,T(90),&quadrant));
+    T s = sin(r);
+    T c = cos(r);
+
+    switch (quadrant & 3) {
+        case 0: sine = s; cosine = c; break;
+        case 1: sine = c; cosine = -s; break;
+        case 2: sine = -s; cosine = -c; break;
+        default: sine = -c; cosine = s; break;
+    }
+}
+inline void sincosDegrees(float x, float &sine, float &cosine){
+    sincosDegreesLibm(x,sine,cosine);
+}
+inline void sincosDegrees(long double x, long double &sine, long double &cosine){
+    sincosDegreesLibm(x,sine,cosine);
+}
+
+/**
+ * @brief ECF to LLA conversion of one point or one pack of points.
+ * @param x, y, z: ECF coordinates in meters.
+ * @param a: Ellipsoid semi-major axis in meters.
+ * @param e2: Ellipsoid eccentricity squared.
+ * @param latitude, longitude, altitude: Receive the LLA coordinates (degrees,
+ * degrees, meters).
+ *
+ * H. Vermeille, "An analytical method to transform geocentric into geodetic
+ * coordinates", Journal of Geodesy 85, 2011. No iteration and no branches:
+ * the poles (p = 0) and the equatorial plane (z = 0) fall out of the same
+ * expressions. Sub-micrometre agreement with a converged iterative solution
+ * for points more than about 50 km from the centre of the Earth.
+ *
+ * Closer than about 43 km (r <= 0 below) the method has no real solution.
+ * There the latitude is atan2(z, (1-e2)*p) and the altitude is measured
+ * along that latitude's normal, and the centre itself is the South Pole at
+ * altitude -b. This matches the iterative solver on the polar axis and in
+ * the equatorial plane.
+ */
+template <class T>
+inline void ecfToLLAClosedForm(T x, T y, T z, double a, double e2, T &latitude, T &longitude, T &altitude){
+    using ::sqrt;
+    using ::atan2;
+    using ::cbrt;
+    const T e2T = T(e2);
+    const T e4 = T(e2*e2);
+    const T invA2 = T(1.0/(a*a));
+
+    T rho2 = x*x + y*y;
+    T rho = sqrt(rho2);
+    T p = rho2*invA2;
+    T q = z*z*(T(1.0-e2)*invA2);
+    T r = (p + q - e4)*T(1.0/6.0);
+    T s = e4*p*q/(T(4.0)*r*r*r);
+    T t = cbrt(T(1.0) + s + sqrt(s*(T(2.0) + s)));
+    T u = r*(T(1.0) + t + T(1.0)/t);
+    T v = sqrt(u*u + e4*q);
+    T w = e2T*(u + v - q)/(T(2.0)*v);
+    T k = sqrt(u + v + w*w) - w;
+    T D = k*rho/(k + e2T);
+
+    //near the centre 2*atan2(z, D + Dz) is computed with D = (1-e2)*p
+    auto degenerate = r <= T(0.0);
+    D = select(degenerate,T(1.0-e2)*rho,D);
+    T Dz = sqrt(D*D + z*z);
+    auto centre = degenerate & (Dz == T(0.0));
+    T sinLat = z/Dz, cosLat = D/Dz;
+    T normal = rho*cosLat + z*sinLat - T(a)*sqrt(T(1.0) - e2T*sinLat*sinLat);
+
+    latitude = select(centre,T(-90.0),toDegrees(T(2.0)*atan2(z,D + Dz)));
+    longitude = toDegrees(atan2(y,x));
+    altitude = select(degenerate,select(centre,T(-a*sqrt(1.0-e2)),normal),(k + e2T - T(1.0))/k*Dz);
+}
+
+/**
+ * @brief LLA to ECF conversion of one point or one pack of points.
+ * @param latitude, longitude: Geodetic angles in degrees.
+ * @param altitude: Altitude above the ellipsoid in meters.
+ * @param a: Ellipsoid semi-major axis in meters.
+ * @param e2: Ellipsoid eccentricity squared.
+ * @param x, y, z: Receive the ECF coordinates in meters.
+ *
+ * One sincosDegrees per angle is shared by the prime vertical radius and all
+ * three coordinates.
+ */
+template <class T>
+inline void llaToECFSinCos(T latitude, T longitude, T altitude, double a, double e2, T &x, T &y, T &z){
+    using ::sqrt;
+    T sinLat, cosLat, sinLon, cosLon;
+
+    sincosDegrees(latitude,sinLat,cosLat);
+    sincosDegrees(longitude,sinLon,cosLon);
+    T N = T(a)/sqrt(T(1.0) - T(e2)*sinLat*sinLat);
+    T r = (N + altitude)*cosLat;
+
+    x = r*cosLon;
+    y = r*sinLon;
+    z = (N*T(1.0-e2) + altitude)*sinLat;
+}
+
+/**
+ * @brief DCA to AER conversion of one point or one pack of points.
+ * @param downRange, crossRange, above: DCA coordinates in meters.
+ * @param azimuth, elevation, range: Receive the AER coordinates (degrees,
+ * degrees, meters).
+ *
+ * Branch free; the zero vector gives zero azimuth and elevation and vertical
+ * vectors zero azimuth, as in DCA::toAER.
+ */
+template <class T>
+inline void dcaToAERPolar(T downRange, T crossRange, T above, T &azimuth, T &elevation, T &range){
+    using ::sqrt;
+    using ::atan2;
+    T p2 = downRange*downRange + crossRange*crossRange;
+
+    range = sqrt(p2 + above*above);
+    azimuth = toDegrees(atan2(-crossRange,downRange));
+    elevation = toDegrees(atan2(above,sqrt(p2)));
+}
+
+/**
+ * @brief AER to DCA conversion of one point or one pack of points.
+ * @param azimuth, elevation, range: AER coordinates (degrees, degrees,
+ * meters).
+ * @param downRange, crossRange, above: Receive the DCA coordinates in meters.
+ */
+template <class T>
+inline void aerToDCAPolar(T azimuth, T elevation, T range, T &downRange, T &crossRange, T &above){
+    T sinAzimuth, cosAzimuth, sinElevation, cosElevation;
+
+    sincosDegrees(azimuth,sinAzimuth,cosAzimuth);
+    sincosDegrees(elevation,sinElevation,cosElevation);
+    T horizontal = range*cosElevation;
+    downRange = horizontal*cosAzimuth;
+    crossRange = -horizontal*sinAzimuth;
+    above = range*sinElevation;
+}
+
+/**
+ * @brief ECF to ENU rotation of a local frame origin.
+ * @param latitude, longitude: Origin geodetic angles in degrees.
+ * @param rotation: Receives the rows East, North and Up in ECF.
+ */
+template <class T>
+inline void enuRotation(T latitude, T longitude, T rotation[3][3]){
+    T sinLat, cosLat, sinLon, cosLon;
+
+    sincosDegrees(latitude,sinLat,cosLat);
+    sincosDegrees(longitude,sinLon,cosLon);
+    rotation[0][0] = -sinLon;
+    rotation[0][1] = cosLon;
+    rotation[0][2] = T(0.0);
+    rotation[1][0] = -sinLat*cosLon;
+    rotation[1][1] = -sinLat*sinLon;
+    rotation[1][2] = cosLat;
+    rotation[2][0] = cosLat*cosLon;
+    rotation[2][1] = cosLat*sinLon;
+    rotation[2][2] = sinLat;
+}
+
+/**
+ * @brief ECF to local frame axes: translation to the origin, then rotation.
+ * @param x, y, z: ECF coordinates in meters.
+ * @param origin: ECF origin of the local frame.
+ * @param rotation: Rows are the local axes in ECF (see enuRotation).
+ * @param first, second, third: Receive the local coordinates in meters.
+ *
+ * The frame may be held in a different type than the points, for example
+ * double constants applied to packs.
+ */
+template <class T, class S>
+inline void rotateToLocal(T x, T y, T z, const S origin[3], const S rotation[3][3], T &first, T &second, T &third){
+    x = x - origin[0];
+    y = y - origin[1];
+    z = z - origin[2];
+    first = rotation[0][0]*x + rotation[0][1]*y + rotation[0][2]*z;
+    second = rotation[1][0]*x + rotation[1][1]*y + rotation[1][2]*z;
+    third = rotation[2][0]*x + rotation[2][1]*y + rotation[2][2]*z;
+}
+
+/**
+ * @brief Local frame axes to ECF: transposed rotation, then translation.
+ * @param first, second, third: Local coordinates in meters.
+ * @param origin: ECF origin of the local frame.
+ * @param rotation: Rows are the local axes in ECF (see enuRotation).
+ * @param x, y, z: Receive the ECF coordinates in meters.
+ */
+template <class T, class S>
+inline void rotateFromLocal(T first, T second, T third, const S origin[3], const S rotation[3][3], T &x, T &y, T &z){
+    x = rotation[0][0]*first + rotation[1][0]*second + rotation[2][0]*third + origin[0];
+    y = rotation[0][1]*first + rotation[1][1]*second + rotation[2][1]*third + origin[1];
+    z = rotation[0][2]*first + rotation[1][2]*second + rotation[2][2]*third + origin[2];
+}
+
+/**
+ * @brief ENU to DCA rotation about the Up axis.
+ * @param east, north, up: ENU coordinates in meters.
+ * @param heading: DCA heading from True North in degrees.
+ * @param downRange, crossRange, above: Receive the DCA coordinates in meters.
+ */
+template <class T>
+inline void enuToDCARotation(T east, T north, T up, T heading, T &downRange, T &crossRange, T &above){
+    T sinHeading, cosHeading;
+
+    sincosDegrees(heading,sinHeading,cosHeading);
+    downRange = east*sinHeading + north*cosHeading;
+    crossRange = -east*cosHeading + north*sinHeading;
+    above = up;
+}
+
+/**
+ * @brief DCA to ENU rotation about the Up axis.
+ * @param downRange, crossRange, above: DCA coordinates in meters.
+ * @param heading: DCA heading from True North in degrees.
+ * @param east, north, up: Receive the ENU coordinates in meters.
+ */
+template <class T>
+inline void dcaToENURotation(T downRange, T crossRange, T above, T heading, T &east, T &north, T &up){
+    T sinHeading, cosHeading;
+
+    sincosDegrees(heading,sinHeading,cosHeading);
+    east = downRange*sinHeading - crossRange*cosHeading;
+    north = downRange*cosHeading + crossRange*sinHeading;
+    up = above;
+}
+
+/**
+ * @brief ECF to LLA conversion on a sphere of radius a.
+ * @param x, y, z: ECF coordinates in meters.
+ * @param a: Sphere radius in meters.
+ * @param latitude, longitude, altitude: Receive the LLA coordinates (degrees,
+ * degrees, meters).
+ *
+ * Geocentric latitude is geodetic on a sphere: two arctangents and two
+ * square roots, no solver.
+ */
+template <class T>
+inline void ecfToLLASpherical(T x, T y, T z, double a, T &latitude, T &longitude, T &altitude){
+    using ::sqrt;
+    using ::atan2;
+    T rho2 = x*x + y*y;
+
+    latitude = toDegrees(atan2(z,sqrt(rho2)));
+    longitude = toDegrees(atan2(y,x));
+    altitude = sqrt(rho2 + z*z) - T(a);
+}
+
+/**
+ * @brief LLA to ECF conversion on a sphere of radius a.
+ * @param latitude, longitude: Angles in degrees.
+ * @param altitude: Altitude above the sphere in meters.
+ * @param a: Sphere radius in meters.
+ * @param x, y, z: Receive the ECF coordinates in meters.
+ */
+template <class T>
+inline void llaToECFSpherical(T latitude, T longitude, T altitude, double a, T &x, T &y, T &z){
+    T sinLat, cosLat, sinLon, cosLon;
+
+    sincosDegrees(latitude,sinLat,cosLat);
+    sincosDegrees(longitude,sinLon,cosLon);
+    T r = (T(a) + altitude)*cosLat;
+
+    x = r*cosLon;
+    y = r*sinLon;
+    z = (T(a) + altitude)*sinLat;
+}
+
+/**
+ * @brief ECF to LLA conversion on a compile-time ellipsoid.
+ * @tparam Ellipsoid: An ellipsoid policy such as WGS84, GRS80 or sphere.
+ * @param x, y, z: ECF coordinates in meters.
+ * @param latitude, longitude, altitude: Receive the LLA coordinates (degrees,
+ * degrees, meters).
+ *
+ * Closed-form solution (ecfToLLAClosedForm) on an ellipsoid; the spherical
+ * formulas when the eccentricity is zero.
+ */
+template <class Ellipsoid, class T>
+inline void ecfToLLAEllipsoid(T x, T y, T z, T &latitude, T &longitude, T &altitude){
+    if (Ellipsoid::spherical) {
+        ecfToLLASpherical(x,y,z,Ellipsoid::a,latitude,longitude,altitude);
+    } else {
+        ecfToLLAClosedForm(x,y,z,Ellipsoid::a,Ellipsoid::e2,latitude,longitude,altitude);
+    }
+}
+
+/**
+ * @brief LLA to ECF conversion on a compile-time ellipsoid.
+ * @tparam Ellipsoid: An ellipsoid policy such as WGS84, GRS80 or sphere.
+ * @param latitude, longitude: Angles in degrees.
+ * @param altitude: Altitude above the ellipsoid in meters.
+ * @param x, y, z: Receive the ECF coordinates in meters.
+ */
+template <class Ellipsoid, class T>
+inline void llaToECFEllipsoid(T latitude, T longitude, T altitude, T &x, T &y, T &z){
+    if (Ellipsoid::spherical) {
+        llaToECFSpherical(latitude,longitude,altitude,Ellipsoid::a,x,y,z);
+    } else {
+        llaToECFSinCos(latitude,longitude,altitude,Ellipsoid::a,Ellipsoid::e2,x,y,z);
+    }
+}
+}
+}
+#endif	/* CONVERSIONKERNELS_H */
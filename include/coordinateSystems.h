@@ -1,8 +1,8 @@
 /**
  * @brief Coordinate systems class library definition.
  * @file coordinateSystems.h
- * @version 19.09
- * @date September 24, 2019
+ * @version 26.10
+ * @date October 17, 2026
  * @details Library of classes representing various coordinate systems and
  * providing the transformations between them. Coordinate systems represented
  * are: East-North-Up (ENU), Downrange-Crossrange-Above (DCA), Latitude-
@@ -14,6 +14,7 @@
  * Version 1.0 on January 13, 2014
  * Version 1.4 on June 6, 2014
  * Version 19.09 on September 24, 2019
+ * Version 26.10 on October 17, 2026
  */
 
 /**
@@ -51,8 +52,11 @@
 #ifndef COORDINATESYSTEMS_H
 #define	COORDINATESYSTEMS_H
 
+#include <array>
 #include <stdexcept>
 #include <vector>
+#include "ellipsoid.h"
+#include "frameRegistry.h"
 
 namespace coordinateSystems {
 
@@ -71,6 +75,36 @@ class LLA; //forward declaration of class LLA
 class ECF; //forward declaration of class ECF
 class AER; //forward declaration of class AER
 
+/**
+ * @brief Algorithm used for the ECF to LLA conversion.
+ *
+ * Worst-case errors against a long double reference over all latitudes
+ * (poles excluded for GEODETIC_ITERATIVE) for altitudes up to 10 km, 1000 km
+ * and 40,000 km, and the cost of one raw conversion relative to
+ * GEODETIC_ITERATIVE:
+ *
+ * GEODETIC_ITERATIVE: original fixed-point loop stopped at latTol, so the
+ * iteration count depends on the point. 4e-6 degrees (0.4 m) of latitude at
+ * any altitude; 2 m of altitude near the poles at low altitude and 110 m at
+ * 40,000 km. Cost 1.0.
+ *
+ * GEODETIC_FIXED: the given number of Bowring iterations with no
+ * convergence test, so the cost does not depend on the point. One iteration:
+ * 1e-11 degrees, 5e-8 degrees (5 mm) and 5e-7 degrees (5 cm) of latitude;
+ * altitude at round-off. Cost 0.3. Two iterations: round-off everywhere,
+ * cost 0.4.
+ *
+ * GEODETIC_MILLIMETRE: Bowring iterations until the latitude changes by
+ * less than millimetreTol, bounded by maxIterations. Round-off everywhere,
+ * normally after two iterations. Cost 0.4.
+ *
+ * GEODETIC_CLOSED_FORM: Vermeille's closed-form solution, the one used by
+ * the batch conversions. Round-off everywhere more than about 50 km from the
+ * centre of the Earth, with no loop or branch, which suits vectorization
+ * better than scalar latency. Cost 0.55.
+ */
+enum geodeticSolver {GEODETIC_ITERATIVE, GEODETIC_FIXED, GEODETIC_MILLIMETRE, GEODETIC_CLOSED_FORM};
+
 /**
  *  @brief Position vector abstract base class.
 */
@@ -127,9 +161,25 @@ public:
  *  @brief Get the coordinates.
  *  @return a vector of 3 double values for the position vector coordinates.
  *
- *  This gets the position vector coordinates from the coordinate system.
+ *  This gets the position vector coordinates from the coordinate system. The
+ *  vector is allocated on the heap on every call; getCoordinates and
+ *  getPosition(double[3]) do not allocate.
 */
     std::vector<double> getPosition(void);
+/**
+ *  @brief Get the coordinates into a buffer.
+ *  @param  _position: receives the first, second and third coordinates.
+ *  @return nothing
+*/
+    void getPosition(double _position[3]);
+/**
+ *  @brief Get the coordinates as a fixed-size array.
+ *  @return the first, second and third coordinates.
+ *
+ *  Returned by value without allocation; in C++17 it unpacks with a
+ *  structured binding, e.g. auto [east, north, up] = enu.getCoordinates();
+*/
+    std::array<double, 3> getCoordinates(void);
 /**
  *  @brief Get the first coordinate.
  *  @return first coordinate.
@@ -224,11 +274,12 @@ public:
     virtual DCA toDCA(double _latitude, double _longitude, double _altitude, double _heading) = 0; // declare pure virtual function for abstract class
     virtual AER toAER(LLA _origin, double _heading) = 0; // declare pure virtual function for abstract class
     virtual AER toAER(double _latitude, double _longitude, double _altitude, double _heading) = 0; // declare pure virtual function for abstract class
-protected:
-    //WGS84
-    static const double a = 6378137.0; //Earth elipsoid semi-major axis in meters
-    static const double e2 = 0.00669437999014; //Earth elipsoid eccentricity squared
-    static const double latTol = 0.00001; //tolerance for latitude convergence
+    //WGS84, see ellipsoid.h for the derived constants
+    static constexpr double a = WGS84::a; //Earth elipsoid semi-major axis in meters
+    static constexpr double e2 = WGS84::e2; //Earth elipsoid eccentricity squared
+    static constexpr double latTol = 0.00001; //tolerance for latitude convergence
+    static constexpr double millimetreTol = 1.5e-10; //latitude tolerance of about one millimetre in radians
+    static constexpr unsigned maxIterations = 8; //iteration bound for GEODETIC_MILLIMETRE
 };
 
 /**
@@ -302,6 +353,43 @@ public:
  * @return Instance of LLA.
  */
     LLA toLLA(void);
+/**
+ * @brief Raw coordinate conversion to Latitude-Longitude-Altitude (LLA) system.
+ * @param _X: X coordinate in meters.
+ * @param _Y: Y coordinate in meters.
+ * @param _Z: Z coordinate in meters.
+ * @param _latitude: Receives the latitude in degrees.
+ * @param _longitude: Receives the longitude in degrees.
+ * @param _altitude: Receives the altitude above the reference datum in meters.
+ * @return Nothing.
+ *
+ * Same conversion as toLLA(void) without constructing intermediate objects.
+ */
+    static void toLLA(double _X, double _Y, double _Z, double &_latitude, double &_longitude, double &_altitude);
+/**
+ * @brief Coordinate conversion to Latitude-Longitude-Altitude (LLA) system
+ * with a selected accuracy and latency.
+ * @param _solver: Algorithm used for the conversion.
+ * @param _iterations: Number of iterations for GEODETIC_FIXED (optional,
+ * default = 1, minimum 1); ignored by the other solvers.
+ * @return Instance of LLA.
+ */
+    LLA toLLA(geodeticSolver _solver, unsigned _iterations = 1);
+/**
+ * @brief Raw coordinate conversion to Latitude-Longitude-Altitude (LLA) system
+ * with a selected accuracy and latency.
+ * @param _X: X coordinate in meters.
+ * @param _Y: Y coordinate in meters.
+ * @param _Z: Z coordinate in meters.
+ * @param _latitude: Receives the latitude in degrees.
+ * @param _longitude: Receives the longitude in degrees.
+ * @param _altitude: Receives the altitude above the reference datum in meters.
+ * @param _solver: Algorithm used for the conversion.
+ * @param _iterations: Number of iterations for GEODETIC_FIXED (optional,
+ * default = 1, minimum 1); ignored by the other solvers.
+ * @return Nothing.
+ */
+    static void toLLA(double _X, double _Y, double _Z, double &_latitude, double &_longitude, double &_altitude, geodeticSolver _solver, unsigned _iterations = 1);
 };
 
 /**
@@ -384,6 +472,19 @@ public:
  * @return Instance of ECF.
  */
     ECF toECF(void);
+/**
+ * @brief Raw coordinate conversion to Earth-Centered-Fixed (ECF) system.
+ * @param _latitude: Latitude in degrees.
+ * @param _longitude: Longitude in degrees.
+ * @param _altitude: Altitude above reference datum in meters.
+ * @param _X: Receives the X coordinate in meters.
+ * @param _Y: Receives the Y coordinate in meters.
+ * @param _Z: Receives the Z coordinate in meters.
+ * @return Nothing.
+ *
+ * Same conversion as toECF(void) without constructing intermediate objects.
+ */
+    static void toECF(double _latitude, double _longitude, double _altitude, double &_X, double &_Y, double &_Z);
 };
 
 /**
@@ -395,12 +496,16 @@ public:
  * Have an origin defined by LLA
  * Have a heading that is only made public in children classes needing it.
  * 
+ * The origin and heading are held as a handle to a frame interned in the
+ * FrameRegistry, so all the points of a frame share one copy of the origin,
+ * its ECF position and its rotations.
 */
 class earthFixed {
 public:
     earthFixed ();
     earthFixed (LLA _origin, double _heading = 0.0);
     earthFixed (double _latitude, double _longitude, double _altitude, double _heading = 0.0);
+    earthFixed (frameHandle _frame);
     virtual ~earthFixed();
 /**
  * @brief Sets the origin of the Earth-fixed coordinate system.
@@ -422,12 +527,15 @@ public:
  * @return Instance of LLA.
  */
     LLA getOrigin(void);
+/**
+ * @brief Gets the shared frame of the Earth-fixed coordinate system.
+ * @return Frame handle.
+ */
+    frameHandle getFrame(void);
     virtual ECF toECF(void) = 0; // declare pure virtual function for abstract class
     virtual LLA toLLA(void) = 0; // declare pure virtual function for abstract class
 protected:
-    LLA origin;
-    bool originSet;
-    double heading;
+    frameHandle frame; //shared origin, heading and rotations
 /**
  * @brief Sets the true heading of the earth fixed coordinate system.
  * @param _heading: Heading of the earth fixed frame measured from True North
@@ -501,6 +609,18 @@ public:
  *  coordinate system.
  */
     ENU (double _east, double _north, double _up, double _latitude, double _longitude, double _altitude);
+/**
+ * @brief Coordinate system constructor.
+ * @param _east: East coordinate in meters.
+ * @param _north: North coordinate in meters.
+ * @param _up: Up coordinate in meters.
+ * @param _frame: Shared frame (see FrameRegistry), its heading is ignored.
+ * @return class instance.
+ * 
+ *  Creates an instance of the coordinate system class, sets the position
+ *  vector coordinates in the coordinate system, and references the frame.
+ */
+    ENU (double _east, double _north, double _up, frameHandle _frame);
     virtual ~ENU();
 /**
  * @brief Coordinate conversion to Earth-Centered-Fixed (ECF) system.
@@ -598,6 +718,19 @@ public:
  *  coordinate system, and the true heading of the DownRange direction.
  */
     DCA (double _downRange, double _crossRange, double _above, double _latitude, double _longitude, double _altitude, double _heading = 0.0);
+/**
+ * @brief Coordinate system constructor.
+ * @param _downRange: DownRange coordinate in meters.
+ * @param _crossRange: CrossRange coordinate in meters.
+ * @param _above: Above coordinate in meters.
+ * @param _frame: Shared frame (see FrameRegistry).
+ * @return class instance.
+ * 
+ *  Creates an instance of the coordinate system class, sets the position
+ *  vector coordinates in the coordinate system, and references the frame
+ *  for the origin and heading.
+ */
+    DCA (double _downRange, double _crossRange, double _above, frameHandle _frame);
     virtual ~DCA();
 /**
  * @brief Use inherited setHeading(heading) method from earthFixed class as a
@@ -633,6 +766,19 @@ public:
  * @return Instance of AER.
  */
     AER toAER(void);
+/**
+ * @brief Raw coordinate conversion to Azimuth-Elevation-Range (AER) system.
+ * @param _downRange: DownRange coordinate in meters.
+ * @param _crossRange: CrossRange coordinate in meters.
+ * @param _above: Above coordinate in meters.
+ * @param _azimuth: Receives the azimuth angle in degrees.
+ * @param _elevation: Receives the elevation angle in degrees.
+ * @param _range: Receives the range in meters.
+ * @return Nothing.
+ *
+ * Same conversion as toAER(void) without constructing intermediate objects.
+ */
+    static void toAER(double _downRange, double _crossRange, double _above, double &_azimuth, double &_elevation, double &_range);
 };
 
 /**
@@ -702,6 +848,19 @@ public:
  *  coordinate system, and the true heading of the DownRange direction.
  */
     AER (double _azimuth, double _elevation, double _range, double _latitude, double _longitude, double _altitude, double _heading = 0.0);
+/**
+ * @brief Coordinate system constructor.
+ * @param _azimuth: Azimuth angle in degrees.
+ * @param _elevation: Elevation angle in degrees.
+ * @param _range: Range coordinate in meters.
+ * @param _frame: Shared frame (see FrameRegistry).
+ * @return class instance.
+ * 
+ *  Creates an instance of the coordinate system class, sets the position
+ *  vector coordinates in the coordinate system, and references the frame
+ *  for the origin and heading.
+ */
+    AER (double _azimuth, double _elevation, double _range, frameHandle _frame);
     virtual ~AER();
 /**
  * @brief Use inherited setHeading(heading) method from earthFixed class as a
@@ -737,6 +896,19 @@ public:
  * @return Instance of DCA.
  */
     DCA toDCA(void);
+/**
+ * @brief Raw coordinate conversion to DownRange-CrossRange-Above (DCA) system.
+ * @param _azimuth: Azimuth angle in degrees.
+ * @param _elevation: Elevation angle in degrees.
+ * @param _range: Range coordinate in meters.
+ * @param _downRange: Receives the DownRange coordinate in meters.
+ * @param _crossRange: Receives the CrossRange coordinate in meters.
+ * @param _above: Receives the Above coordinate in meters.
+ * @return Nothing.
+ *
+ * Same conversion as toDCA(void) without constructing intermediate objects.
+ */
+    static void toDCA(double _azimuth, double _elevation, double _range, double &_downRange, double &_crossRange, double &_above);
 };
 }
 #endif	/* COORDINATESYSTEMS_H */
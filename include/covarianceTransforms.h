@@ -0,0 +1,197 @@
+/**
+ * @brief Covariance transformation definitions.
+ * @file covarianceTransforms.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Analytic Jacobians and batched 3x3 covariance transforms between
+ * the ECF, ENU, DCA and AER frames of a LocalFrame.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef COVARIANCETRANSFORMS_H
+#define	COVARIANCETRANSFORMS_H
+
+#include <stddef.h>
+#include "batchConversions.h"
+#include "localFrame.h"
+
+namespace coordinateSystems {
+
+/*
+ * Covariance transforms: each covariance is a 3x3 matrix stored row-major
+ * in 9 consecutive doubles, in the units of the coordinates (meters, and
+ * degrees for the AER angles). A covariance P is mapped to J*P*J^T, where J
+ * is the Jacobian of the position conversion. Between ECF, ENU and DCA the
+ * Jacobian is the constant rotation cached by the frame; to and from AER it
+ * also depends on the position, which is given in the input frame. The
+ * output may be the input array.
+ *
+ * At the frame origin (zero range) and on the Above axis (zero horizontal
+ * range) the AER angles are undefined and so are their derivatives: the
+ * rows of the angles that are undefined are set to zero, as the position
+ * conversions report zero for those angles.
+ */
+
+/**
+ * @brief Jacobian of the DCA to AER conversion.
+ * @param _downRange: DownRange coordinate in meters.
+ * @param _crossRange: CrossRange coordinate in meters.
+ * @param _above: Above coordinate in meters.
+ * @param _jacobian: Receives the derivatives of azimuth and elevation
+ * (degrees) and range (meters) with respect to DownRange, CrossRange and
+ * Above (meters), one row per AER coordinate.
+ * @return Nothing.
+ */
+void dcaToAERJacobian(double _downRange, double _crossRange, double _above, double _jacobian[3][3]);
+/**
+ * @brief Jacobian of the AER to DCA conversion.
+ * @param _azimuth: Azimuth angle in degrees.
+ * @param _elevation: Elevation angle in degrees.
+ * @param _range: Range in meters.
+ * @param _jacobian: Receives the derivatives of DownRange, CrossRange and
+ * Above (meters) with respect to azimuth and elevation (degrees) and range
+ * (meters), one row per DCA coordinate.
+ * @return Nothing.
+ */
+void aerToDCAJacobian(double _azimuth, double _elevation, double _range, double _jacobian[3][3]);
+/**
+ * @brief Jacobian of the ECF to AER conversion in a frame, the measurement
+ * matrix of an AER sensor tracking in ECF.
+ * @param _ecf: ECF position.
+ * @param _frame: Frame (origin and heading).
+ * @param _jacobian: Receives the derivatives of azimuth and elevation
+ * (degrees) and range (meters) with respect to X, Y and Z (meters).
+ * @return Nothing.
+ */
+void ecfToAERJacobian(ECFVec _ecf, LocalFrame &_frame, double _jacobian[3][3]);
+
+/**
+ * @brief Batch covariance transform from ECF to ENU.
+ * @param _count: Number of covariances.
+ * @param _in: ECF covariances.
+ * @param _out: Receives the ENU covariances.
+ * @param _frame: Frame (origin).
+ * @return Nothing.
+ */
+void ecfToENUCovariance(size_t _count, const double *_in, double *_out, LocalFrame &_frame);
+/**
+ * @brief Batch covariance transform from ENU to ECF.
+ * @param _count: Number of covariances.
+ * @param _in: ENU covariances.
+ * @param _out: Receives the ECF covariances.
+ * @param _frame: Frame (origin).
+ * @return Nothing.
+ */
+void enuToECFCovariance(size_t _count, const double *_in, double *_out, LocalFrame &_frame);
+/**
+ * @brief Batch covariance transform from ENU to DCA.
+ * @param _count: Number of covariances.
+ * @param _in: ENU covariances.
+ * @param _out: Receives the DCA covariances.
+ * @param _frame: Frame (heading).
+ * @return Nothing.
+ */
+void enuToDCACovariance(size_t _count, const double *_in, double *_out, LocalFrame &_frame);
+/**
+ * @brief Batch covariance transform from DCA to ENU.
+ * @param _count: Number of covariances.
+ * @param _in: DCA covariances.
+ * @param _out: Receives the ENU covariances.
+ * @param _frame: Frame (heading).
+ * @return Nothing.
+ */
+void dcaToENUCovariance(size_t _count, const double *_in, double *_out, LocalFrame &_frame);
+/**
+ * @brief Batch covariance transform from ECF to DCA.
+ * @param _count: Number of covariances.
+ * @param _in: ECF covariances.
+ * @param _out: Receives the DCA covariances.
+ * @param _frame: Frame (origin and heading).
+ * @return Nothing.
+ */
+void ecfToDCACovariance(size_t _count, const double *_in, double *_out, LocalFrame &_frame);
+/**
+ * @brief Batch covariance transform from DCA to ECF.
+ * @param _count: Number of covariances.
+ * @param _in: DCA covariances.
+ * @param _out: Receives the ECF covariances.
+ * @param _frame: Frame (origin and heading).
+ * @return Nothing.
+ */
+void dcaToECFCovariance(size_t _count, const double *_in, double *_out, LocalFrame &_frame);
+/**
+ * @brief Batch covariance transform from DCA to AER.
+ * @param _count: Number of covariances.
+ * @param _positions: DCA positions the covariances are taken at.
+ * @param _in: DCA covariances.
+ * @param _out: Receives the AER covariances.
+ * @return Nothing.
+ */
+void dcaToAERCovariance(size_t _count, constCoordinateArray _positions, const double *_in, double *_out);
+/**
+ * @brief Batch covariance transform from AER to DCA.
+ * @param _count: Number of covariances.
+ * @param _positions: AER positions the covariances are taken at.
+ * @param _in: AER covariances.
+ * @param _out: Receives the DCA covariances.
+ * @return Nothing.
+ */
+void aerToDCACovariance(size_t _count, constCoordinateArray _positions, const double *_in, double *_out);
+/**
+ * @brief Batch covariance transform from ECF to AER, fusing the frame
+ * rotation and the polar Jacobian into one matrix per point.
+ * @param _count: Number of covariances.
+ * @param _positions: ECF positions the covariances are taken at.
+ * @param _in: ECF covariances.
+ * @param _out: Receives the AER covariances.
+ * @param _frame: Frame (origin and heading).
+ * @return Nothing.
+ */
+void ecfToAERCovariance(size_t _count, constCoordinateArray _positions, const double *_in, double *_out, LocalFrame &_frame);
+/**
+ * @brief Batch covariance transform from AER to ECF, fusing the polar
+ * Jacobian and the frame rotation into one matrix per point.
+ * @param _count: Number of covariances.
+ * @param _positions: AER positions the covariances are taken at.
+ * @param _in: AER covariances.
+ * @param _out: Receives the ECF covariances.
+ * @param _frame: Frame (origin and heading).
+ * @return Nothing.
+ */
+void aerToECFCovariance(size_t _count, constCoordinateArray _positions, const double *_in, double *_out, LocalFrame &_frame);
+}
+#endif	/* COVARIANCETRANSFORMS_H */
@@ -0,0 +1,134 @@
+/**
+ * @brief Compile-time reference ellipsoids.
+ * @file ellipsoid.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Reference ellipsoids (WGS84, GRS80, a sphere, or user-defined) as
+ * policy types whose defining and derived constants are all constexpr. Holds
+ * constants only, so any header can include it.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef ELLIPSOID_H
+#define	ELLIPSOID_H
+
+namespace coordinateSystems {
+
+/**
+ * @brief Square root usable in constant expressions.
+ * @param _x: Non-negative argument.
+ * @param _guess: Current Newton iterate (optional, starts at 1.0).
+ * @param _iterations: Iterations left (optional).
+ * @return sqrt(_x) to within one unit in the last place.
+ *
+ * C++11 constexpr functions are a single return statement, so the Newton
+ * iteration is written as a recursion that stops once the iterate is stable.
+ */
+constexpr double constexprSqrt(double _x, double _guess = 1.0, int _iterations = 64){
+    return (_iterations == 0 || _guess == 0.5*(_guess + _x/_guess)) ? _guess :
+        constexprSqrt(_x, 0.5*(_guess + _x/_guess), _iterations - 1);
+}
+
+/**
+ * @brief Reference ellipsoid policy.
+ * @tparam Definition: Type with static constexpr double members a (semi-major
+ * axis in meters) and e2 (eccentricity squared, zero for a sphere).
+ *
+ * Every derived constant is computed at compile time. Conversions templated
+ * on an ellipsoid (ecfToLLAEllipsoid and llaToECFEllipsoid in
+ * conversionKernels.h) fold them into the code, and the spherical case skips
+ * the geodetic solver. A user-defined ellipsoid is a
+ * definition type:
+ *
+ *     struct mars2000Definition {
+ *         static constexpr double a = 3396190.0;
+ *         static constexpr double e2 = 0.01177586;
+ *     };
+ *     typedef ellipsoid<mars2000Definition> mars2000;
+ */
+template <class Definition>
+struct ellipsoid {
+    static constexpr double a = Definition::a; //semi-major axis in meters
+    static constexpr double e2 = Definition::e2; //eccentricity squared
+    static constexpr double oneMinusE2 = 1.0 - e2; //(b/a)^2
+    static constexpr double b = constexprSqrt(a*a*oneMinusE2); //semi-minor axis in meters
+    static constexpr double ratio = b/a; //b/a, one minus the flattening
+    static constexpr double ep2 = e2/oneMinusE2; //second eccentricity squared
+    static constexpr double aE2 = a*e2; //a*e2
+    static constexpr double e4 = e2*e2; //e2 squared
+    static constexpr bool spherical = (e2 == 0.0); //selects the spherical fast path
+};
+
+template <class Definition> constexpr double ellipsoid<Definition>::a;
+template <class Definition> constexpr double ellipsoid<Definition>::e2;
+template <class Definition> constexpr double ellipsoid<Definition>::oneMinusE2;
+template <class Definition> constexpr double ellipsoid<Definition>::b;
+template <class Definition> constexpr double ellipsoid<Definition>::ratio;
+template <class Definition> constexpr double ellipsoid<Definition>::ep2;
+template <class Definition> constexpr double ellipsoid<Definition>::aE2;
+template <class Definition> constexpr double ellipsoid<Definition>::e4;
+template <class Definition> constexpr bool ellipsoid<Definition>::spherical;
+
+/**
+ * @brief WGS84 defining constants, as used by the coordinate system classes.
+ */
+struct wgs84Definition {
+    static constexpr double a = 6378137.0;
+    static constexpr double e2 = 0.00669437999014;
+};
+
+/**
+ * @brief GRS80 defining constants.
+ */
+struct grs80Definition {
+    static constexpr double a = 6378137.0;
+    static constexpr double e2 = 0.00669438002290;
+};
+
+/**
+ * @brief Sphere of the IUGG mean Earth radius.
+ */
+struct sphereDefinition {
+    static constexpr double a = 6371008.8;
+    static constexpr double e2 = 0.0;
+};
+
+typedef ellipsoid<wgs84Definition> WGS84;
+typedef ellipsoid<grs80Definition> GRS80;
+typedef ellipsoid<sphereDefinition> sphere;
+}
+#endif	/* ELLIPSOID_H */
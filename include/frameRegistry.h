@@ -0,0 +1,169 @@
+/**
+ * @brief Shared Earth-fixed frame registry definition.
+ * @file frameRegistry.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Interns the origins and headings of Earth-fixed points so that
+ * every ENU, DCA and AER point of a frame references one shared, precomputed
+ * copy of the frame instead of holding its own, with a per-thread cache in
+ * front of the registry for the conversions given raw origin coordinates.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef FRAMEREGISTRY_H
+#define	FRAMEREGISTRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+
+/*
+ * Included by coordinateSystems.h, so it depends on nothing else in the
+ * library.
+ */
+
+namespace coordinateSystems {
+
+/**
+ * @brief Origin, heading and precomputed conversion data of an Earth-fixed
+ * frame, shared read-only by all the points expressed in it.
+ */
+struct frameData {
+    double latitude, longitude, altitude; //origin in degrees and meters, zero if not set
+    double heading; //degrees from True North
+    bool originSet;
+    double originECF[3]; //origin ECF position in meters
+    double enuRotation[3][3]; //ECF to ENU rotation, rows are E, N, U
+    double dcaRotation[3][3]; //ECF to DCA rotation, rows are D, C, A
+};
+
+/**
+ * @brief Compact reference to a shared frame.
+ */
+typedef std::shared_ptr<const frameData> frameHandle;
+
+/**
+ * @brief Registry of the frames in use.
+ *
+ * Every origin and heading is computed once: interning a frame that is
+ * already referenced returns the existing handle, so a million points in
+ * one frame share one frameData. The registry only holds weak references,
+ * so a frame is freed with its last point. Thread-safe.
+ */
+class FrameRegistry {
+public:
+/**
+ * @brief Gets the shared frame with an origin and a heading.
+ * @param _latitude: Origin latitude in degrees.
+ * @param _longitude: Origin longitude in degrees.
+ * @param _altitude: Origin altitude in meters.
+ * @param _heading: Heading from True North in degrees (optional, default  = 0.0).
+ * @return Frame handle.
+ */
+    static frameHandle intern(double _latitude, double _longitude, double _altitude, double _heading = 0.0);
+/**
+ * @brief Gets the shared frame with a heading and no origin.
+ * @param _heading: Heading from True North in degrees (optional, default  = 0.0).
+ * @return Frame handle.
+ */
+    static frameHandle internHeading(double _heading = 0.0);
+/**
+ * @brief Gets the number of frames still referenced.
+ * @return Frame count.
+ */
+    static size_t size(void);
+};
+
+/**
+ * @brief Bounded cache of frames in front of the FrameRegistry.
+ *
+ * Used by the conversions and constructors that take raw origin coordinates
+ * (e.g. ECF::toENU(latitude, longitude, altitude)), so callers that pass the
+ * same few origins over and over reuse the frame instead of rebuilding its
+ * trigonometry or taking the registry lock. Each thread has its own 4-way
+ * set-associative table of slotCount frames, so a hit takes no lock and
+ * shares no cache line with other threads; a miss interns the frame and
+ * replaces the least recently used frame of its set. The cache holds strong
+ * references, which keeps up to slotCount recently used frames per thread
+ * alive after their last point.
+*/
+class FrameCache {
+public:
+    static const unsigned slotCount = 64; //frames per thread
+/**
+ * @brief Hit and miss totals over all threads since the last reset.
+ */
+    struct statistics {
+        uint64_t hits;
+        uint64_t misses;
+    };
+/**
+ * @brief Gets the frame with an origin and a heading.
+ * @param _latitude: Origin latitude in degrees.
+ * @param _longitude: Origin longitude in degrees.
+ * @param _altitude: Origin altitude in meters.
+ * @param _heading: Heading from True North in degrees (optional, default  = 0.0).
+ * @return Frame handle, the same as FrameRegistry::intern would return.
+ */
+    static frameHandle get(double _latitude, double _longitude, double _altitude, double _heading = 0.0);
+/**
+ * @brief Gets the frame with a heading and no origin.
+ * @param _heading: Heading from True North in degrees (optional, default  = 0.0).
+ * @return Frame handle, the same as FrameRegistry::internHeading would return.
+ */
+    static frameHandle getHeading(double _heading = 0.0);
+/**
+ * @brief Sums the hits and misses of all threads, including threads that
+ * have exited since the last reset.
+ * @return Totals.
+ */
+    static statistics getStatistics(void);
+/**
+ * @brief Zeroes the hits and misses of all threads.
+ * @return Nothing.
+ *
+ * Lookups made by other threads while the reset runs may be lost.
+ */
+    static void resetStatistics(void);
+/**
+ * @brief Empties the cache of the calling thread, releasing its frames.
+ * @return Nothing.
+ */
+    static void clear(void);
+};
+}
+#endif	/* FRAMEREGISTRY_H */
@@ -0,0 +1,263 @@
+/**
+ * @brief Frame-tagged coordinate value types.
+ * @file frameTypes.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Header-only, trivially copyable triples tagged with their
+ * coordinate system at compile time, with inline conversions and adapters to
+ * and from the coordinate system classes.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef FRAMETYPES_H
+#define	FRAMETYPES_H
+
+#include <math.h>
+#include <type_traits>
+#include "coordinateSystems.h"
+
+namespace coordinateSystems {
+
+/*
+ * Frame tags. They only select the coordinate system of a Vec3 at compile
+ * time and are never instantiated.
+ */
+struct ecfTag {};
+struct llaTag {};
+struct enuTag {};
+struct dcaTag {};
+struct aerTag {};
+
+/**
+ * @brief Coordinate triple in the frame given by FrameTag.
+ *
+ * Plain value type: no virtual functions, no origin or heading, 24 bytes,
+ * trivially copyable and usable in constant expressions, so it can be stored
+ * in contiguous arrays, passed in registers and copied with memcpy. The local
+ * frame of ENU, DCA and AER values is supplied by the caller (a LocalFrame or
+ * an origin and heading) when converting.
+ *
+ * Coordinates follow the classes: ECF/ENU/DCA in meters, LLA as latitude and
+ * longitude in degrees and altitude in meters, AER as azimuth and elevation
+ * in degrees and range in meters.
+*/
+template <class FrameTag>
+struct Vec3 {
+    typedef FrameTag frame;
+    double first, second, third;
+/**
+ * @brief Default constructor, all coordinates zero.
+ * @return struct instance.
+ */
+    constexpr Vec3() : first(0.0), second(0.0), third(0.0) {}
+/**
+ * @brief Constructor.
+ * @param _first: First coordinate.
+ * @param _second: Second coordinate.
+ * @param _third: Third coordinate.
+ * @return struct instance.
+ */
+    constexpr Vec3(double _first, double _second, double _third) : first(_first), second(_second), third(_third) {}
+};
+
+template <class FrameTag>
+constexpr bool operator==(Vec3<FrameTag> a, Vec3<FrameTag> b) {
+    return a.first == b.first && a.second == b.second && a.third == b.third;
+}
+template <class FrameTag>
+constexpr bool operator!=(Vec3<FrameTag> a, Vec3<FrameTag> b) {
+    return !(a == b);
+}
+
+typedef Vec3<ecfTag> ECFVec;
+typedef Vec3<llaTag> LLAVec;
+typedef Vec3<enuTag> ENUVec;
+typedef Vec3<dcaTag> DCAVec;
+typedef Vec3<aerTag> AERVec;
+
+static_assert(std::is_trivially_copyable<ECFVec>::value, "Vec3 must be trivially copyable");
+static_assert(std::is_standard_layout<ECFVec>::value, "Vec3 must be standard layout");
+static_assert(sizeof(ECFVec) == 3*sizeof(double), "Vec3 must hold exactly three doubles");
+
+/***** conversions ************************************************************/
+/*
+ * Same formulas and special cases as the class conversions, inline.
+ */
+
+/**
+ * @brief Coordinate conversion from LLA to ECF.
+ * @param _lla: Position to convert.
+ * @return ECF position.
+ */
+inline ECFVec toECF(LLAVec _lla) {
+    double sinLat = sin(_lla.first*deg2rad);
+    double cosLat = cos(_lla.first*deg2rad);
+    double N = earthCentered::a / sqrt(1-earthCentered::e2*sinLat*sinLat);
+    return ECFVec((N + _lla.third)*cosLat*cos(_lla.second*deg2rad),
+            (N + _lla.third)*cosLat*sin(_lla.second*deg2rad),
+            (N*(1-earthCentered::e2) + _lla.third)*sinLat);
+}
+/**
+ * @brief Coordinate conversion from ECF to LLA (iterative, as ECF::toLLA).
+ * @param _ecf: Position to convert.
+ * @return LLA position.
+ */
+inline LLAVec toLLA(ECFVec _ecf) {
+    LLAVec lla;
+    ECF::toLLA(_ecf.first,_ecf.second,_ecf.third,lla.first,lla.second,lla.third);
+    return lla;
+}
+/**
+ * @brief Coordinate conversion from DCA to AER.
+ * @param _dca: Position to convert.
+ * @return AER position in the same local frame.
+ */
+inline AERVec toAER(DCAVec _dca) {
+    double p = sqrt(_dca.first*_dca.first + _dca.second*_dca.second);
+    double range = sqrt(_dca.first*_dca.first + _dca.second*_dca.second + _dca.third*_dca.third);
+    if (range == 0) {
+        return AERVec(0.0,0.0,0.0); //undefined azimuth and elevation
+    } else if (p == 0) {
+        return AERVec(0.0,((_dca.third > 0) ? PI/2 : -PI/2)*rad2deg,range); //vertical
+    }
+    return AERVec(atan2(-_dca.second,_dca.first)*rad2deg,atan2(_dca.third,p)*rad2deg,range);
+}
+/**
+ * @brief Coordinate conversion from AER to DCA.
+ * @param _aer: Position to convert.
+ * @return DCA position in the same local frame.
+ */
+inline DCAVec toDCA(AERVec _aer) {
+    double cosElevation = cos(_aer.second*deg2rad);
+    return DCAVec(_aer.third*cos(_aer.first*deg2rad)*cosElevation,
+            -_aer.third*sin(_aer.first*deg2rad)*cosElevation,
+            _aer.third*sin(_aer.second*deg2rad));
+}
+/**
+ * @brief Coordinate conversion from ENU to DCA.
+ * @param _enu: Position to convert.
+ * @param _heading: Heading of the DCA axes measured from True North in degrees.
+ * @return DCA position.
+ */
+inline DCAVec toDCA(ENUVec _enu, double _heading) {
+    double sinHeading = sin(_heading*deg2rad);
+    double cosHeading = cos(_heading*deg2rad);
+    return DCAVec(_enu.first*sinHeading + _enu.second*cosHeading,
+            -_enu.first*cosHeading + _enu.second*sinHeading,
+            _enu.third);
+}
+/**
+ * @brief Coordinate conversion from DCA to ENU.
+ * @param _dca: Position to convert.
+ * @param _heading: Heading of the DCA axes measured from True North in degrees.
+ * @return ENU position.
+ */
+inline ENUVec toENU(DCAVec _dca, double _heading) {
+    double sinHeading = sin(_heading*deg2rad);
+    double cosHeading = cos(_heading*deg2rad);
+    return ENUVec(_dca.first*sinHeading - _dca.second*cosHeading,
+            _dca.first*cosHeading + _dca.second*sinHeading,
+            _dca.third);
+}
+/**
+ * @brief Coordinate conversion from ENU to AER.
+ * @param _enu: Position to convert.
+ * @param _heading: Heading of the AER axes measured from True North in degrees.
+ * @return AER position.
+ */
+inline AERVec toAER(ENUVec _enu, double _heading) {
+    return toAER(toDCA(_enu,_heading));
+}
+/**
+ * @brief Coordinate conversion from AER to ENU.
+ * @param _aer: Position to convert.
+ * @param _heading: Heading of the AER axes measured from True North in degrees.
+ * @return ENU position.
+ */
+inline ENUVec toENU(AERVec _aer, double _heading) {
+    return toENU(toDCA(_aer),_heading);
+}
+
+/***** adapters ***************************************************************/
+/*
+ * Coordinates are copied unchanged in both directions. Values of the local
+ * systems carry no origin or heading, so those are dropped going to a Vec3 and
+ * are given again coming back (or left unset, as with the class
+ * constructors).
+ */
+
+inline ECFVec toVec3(ECF _ecf) {
+    return ECFVec(_ecf.getFirstCoordinate(),_ecf.getSecondCoordinate(),_ecf.getThirdCoordinate());
+}
+inline LLAVec toVec3(LLA _lla) {
+    return LLAVec(_lla.getFirstCoordinate(),_lla.getSecondCoordinate(),_lla.getThirdCoordinate());
+}
+inline ENUVec toVec3(ENU _enu) {
+    return ENUVec(_enu.getFirstCoordinate(),_enu.getSecondCoordinate(),_enu.getThirdCoordinate());
+}
+inline DCAVec toVec3(DCA _dca) {
+    return DCAVec(_dca.getFirstCoordinate(),_dca.getSecondCoordinate(),_dca.getThirdCoordinate());
+}
+inline AERVec toVec3(AER _aer) {
+    return AERVec(_aer.getFirstCoordinate(),_aer.getSecondCoordinate(),_aer.getThirdCoordinate());
+}
+inline ECF toClass(ECFVec _ecf) {
+    return ECF(_ecf.first,_ecf.second,_ecf.third);
+}
+inline LLA toClass(LLAVec _lla) {
+    return LLA(_lla.first,_lla.second,_lla.third);
+}
+inline ENU toClass(ENUVec _enu) {
+    return ENU(_enu.first,_enu.second,_enu.third);
+}
+inline DCA toClass(DCAVec _dca, double _heading = 0.0) {
+    return DCA(_dca.first,_dca.second,_dca.third,_heading);
+}
+inline AER toClass(AERVec _aer, double _heading = 0.0) {
+    return AER(_aer.first,_aer.second,_aer.third,_heading);
+}
+inline ENU toClass(ENUVec _enu, LLA _origin) {
+    return ENU(_enu.first,_enu.second,_enu.third,_origin);
+}
+inline DCA toClass(DCAVec _dca, LLA _origin, double _heading) {
+    return DCA(_dca.first,_dca.second,_dca.third,_origin,_heading);
+}
+inline AER toClass(AERVec _aer, LLA _origin, double _heading) {
+    return AER(_aer.first,_aer.second,_aer.third,_origin,_heading);
+}
+}
+#endif	/* FRAMETYPES_H */
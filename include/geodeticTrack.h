@@ -0,0 +1,126 @@
+/**
+ * @brief Warm-started ECF to LLA conversion class definition.
+ * @file geodeticTrack.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Stateful converter for time-ordered tracks that seeds the Bowring
+ * latitude iteration of each point from the latitudes of the previous points,
+ * so consecutive points usually converge in one iteration.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef GEODETICTRACK_H
+#define	GEODETICTRACK_H
+
+#include <stddef.h>
+#include "coordinateSystems.h"
+#include "batchConversions.h"
+
+namespace coordinateSystems {
+
+/**
+ * @brief ECF to LLA conversion of time-ordered points.
+ *
+ * Each conversion seeds Bowring's iteration with the latitude extrapolated
+ * linearly from the two previous results (or the previous result after the
+ * first point) instead of the reduced latitude of the point itself. One
+ * iteration from a seed off by d radians leaves a latitude error of about
+ * 0.005 d^2, so the iteration stops once the step is below trackTol and the
+ * result is then within 1e-12 radians (6 micrometres) of the exact latitude,
+ * well inside the millimetre bound of GEODETIC_MILLIMETRE. Points of a
+ * smooth track less than about 60 m from the extrapolated latitude converge
+ * in one iteration; further points take more, and a point far from the seed
+ * (the start of a new track) restarts from the usual seed, so any input
+ * order gives correct results and only the cost depends on the order.
+ *
+ * Keeps state between calls: use one instance per track and thread.
+*/
+class GeodeticTrack {
+public:
+/**
+ * @brief Geodetic track constructor.
+ * @return class instance with no previous point.
+ */
+    GeodeticTrack ();
+    ~GeodeticTrack();
+/**
+ * @brief Forgets the previous points, e.g. at the start of a new track.
+ * @return Nothing.
+ */
+    void reset(void);
+/**
+ * @brief Coordinate conversion from ECF to Latitude-Longitude-Altitude (LLA)
+ * system seeded from the previous points.
+ * @param _ecf: Position to convert (instance of ECF).
+ * @return Instance of LLA.
+ */
+    LLA toLLA(ECF _ecf);
+/**
+ * @brief Coordinate conversion from ECF to LLA system seeded from the
+ * previous points, without constructing intermediate objects.
+ * @param _X: ECF x coordinate in meters.
+ * @param _Y: ECF y coordinate in meters.
+ * @param _Z: ECF z coordinate in meters.
+ * @param _latitude: Receives latitude in degrees.
+ * @param _longitude: Receives longitude in degrees.
+ * @param _altitude: Receives altitude in meters.
+ * @return Nothing.
+ */
+    void toLLA(double _X, double _Y, double _Z, double &_latitude, double &_longitude, double &_altitude);
+/**
+ * @brief Converts consecutive points of a track from ECF to LLA in order.
+ * @param _count: Number of points.
+ * @param _in: ECF points in meters, in track order.
+ * @param _out: Receives LLA points (degrees, degrees, meters); may be the
+ * input array.
+ * @return Nothing.
+ */
+    void toLLA(size_t _count, constCoordinateArray _in, coordinateArray _out);
+/**
+ * @brief Gets the number of iterations used by the last conversion.
+ * @return Iteration count.
+ */
+    unsigned getIterations(void);
+    static constexpr double trackTol = 1.0e-5; //step in radians below which one iteration is exact to 1e-12 rad
+    static constexpr double restartTol = 1.0e-2; //first step in radians above which the seed is discarded
+private:
+    unsigned history; //number of previous latitudes held, up to 2
+    double sinLatitude[2], cosLatitude[2]; //previous latitudes, most recent first
+    unsigned iterations;
+};
+}
+#endif	/* GEODETICTRACK_H */
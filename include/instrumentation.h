@@ -0,0 +1,188 @@
+/**
+ * @brief Optional hot-path instrumentation definition.
+ * @file instrumentation.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Per-thread conversion counters, ECF to LLA iteration histograms by
+ * altitude band and latency histograms, with a snapshot API for export to a
+ * metrics system. The hooks in the library compile to nothing unless
+ * COORDINATESYSTEMS_INSTRUMENTATION is defined for the whole build.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef INSTRUMENTATION_H
+#define	INSTRUMENTATION_H
+
+#include <stdint.h>
+#include <chrono>
+
+namespace coordinateSystems {
+namespace instrumentation {
+
+/**
+ * @brief Events counted by the instrumentation.
+ *
+ * COUNTER_ECF_TO_LLA and COUNTER_LLA_TO_ECF count scalar geodetic
+ * conversions, including those made internally for frame origins.
+ * COUNTER_TO_LOCAL and COUNTER_FROM_LOCAL count scalar conversions between
+ * ECF and a local frame (ENU, DCA or AER) by the classes and LocalFrame.
+ * COUNTER_BATCH_CALLS and COUNTER_BATCH_POINTS count batch kernel calls and
+ * the points they convert. COUNTER_ORIGIN_NOT_SET counts conversions that
+ * threw because the origin was not set.
+ */
+enum counter {COUNTER_ECF_TO_LLA, COUNTER_LLA_TO_ECF, COUNTER_TO_LOCAL, COUNTER_FROM_LOCAL,
+    COUNTER_BATCH_CALLS, COUNTER_BATCH_POINTS, COUNTER_ORIGIN_NOT_SET, COUNTER_COUNT};
+
+/**
+ * @brief Operations whose latency is recorded: a scalar ECF to LLA
+ * conversion and a whole batch kernel call.
+ */
+enum timer {TIMER_ECF_TO_LLA, TIMER_BATCH_CALL, TIMER_COUNT};
+
+static const unsigned iterationBins = 16; //0 to 14 iterations, the last bin holds 15 or more
+static const unsigned altitudeBands = 6; //see altitudeBandLimit
+static const unsigned latencyBins = 32; //bin i holds [2^i, 2^(i+1)) ns, bin 0 also holds 0 ns
+
+/**
+ * @brief Totals over all threads since the last reset.
+ */
+struct snapshot {
+    uint64_t counters[COUNTER_COUNT];
+    uint64_t iterations[altitudeBands][iterationBins]; //ECF to LLA calls by altitude band and iteration count
+    uint64_t latency[TIMER_COUNT][latencyBins]; //calls by timer and latency bin
+};
+
+/**
+ * @brief Tells whether the library was built with the instrumentation.
+ * @return True if COORDINATESYSTEMS_INSTRUMENTATION was defined.
+ */
+bool enabled(void);
+/**
+ * @brief Sums the counters and histograms of all threads, including threads
+ * that have exited since the last reset.
+ * @return Totals; all zero if the instrumentation is not built.
+ *
+ * Each thread writes only its own counters, so the snapshot does not stop
+ * conversions; events recorded while it runs may or may not be included.
+ */
+snapshot getSnapshot(void);
+/**
+ * @brief Zeroes the counters and histograms of all threads.
+ * @return Nothing.
+ *
+ * Events recorded by other threads while the reset runs may be lost.
+ */
+void reset(void);
+/**
+ * @brief Name of a counter for export, e.g. "ecf_to_lla".
+ * @param _counter: Counter.
+ * @return Name.
+ */
+const char *counterName(counter _counter);
+/**
+ * @brief Name of a timer for export, e.g. "ecf_to_lla".
+ * @param _timer: Timer.
+ * @return Name.
+ */
+const char *timerName(timer _timer);
+/**
+ * @brief Upper altitude limit of an iteration histogram band.
+ * @param _band: Band index, below altitudeBands.
+ * @return Limit in meters; band 0 holds altitudes below 0 m, each later band
+ * the altitudes from the previous limit up to its own (0 m, 10 km, 100 km,
+ * 1000 km, 10,000 km, infinity).
+ */
+double altitudeBandLimit(unsigned _band);
+
+/**
+ * @brief Adds events to a counter of the calling thread.
+ * @param _counter: Counter.
+ * @param _events: Number of events.
+ * @return Nothing.
+ */
+void count(counter _counter, uint64_t _events);
+/**
+ * @brief Records the iteration count of an ECF to LLA conversion.
+ * @param _iterations: Iterations used by the solver (0 for closed form).
+ * @param _altitude: Resulting altitude in meters.
+ * @return Nothing.
+ */
+void recordIterations(unsigned _iterations, double _altitude);
+/**
+ * @brief Records a latency.
+ * @param _timer: Timer.
+ * @param _nanoseconds: Elapsed time in nanoseconds.
+ * @return Nothing.
+ */
+void recordLatency(timer _timer, uint64_t _nanoseconds);
+
+/**
+ * @brief Records the lifetime of the object as a latency.
+ */
+class scopedTimer {
+public:
+    scopedTimer(timer _timer) : which(_timer), start(std::chrono::steady_clock::now()){
+    }
+    ~scopedTimer(){
+        recordLatency(which,std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+private:
+    timer which;
+    std::chrono::steady_clock::time_point start;
+};
+
+}
+}
+
+/*
+ * Hooks placed in the library. They expand to nothing (or only mark their
+ * arguments as used) unless COORDINATESYSTEMS_INSTRUMENTATION is defined.
+ */
+#ifdef COORDINATESYSTEMS_INSTRUMENTATION
+#define COORDINATESYSTEMS_COUNT(name, events) \
+    coordinateSystems::instrumentation::count(coordinateSystems::instrumentation::name,events)
+#define COORDINATESYSTEMS_ITERATIONS(iterations, altitude) \
+    coordinateSystems::instrumentation::recordIterations(iterations,altitude)
+#define COORDINATESYSTEMS_TIME(name) \
+    coordinateSystems::instrumentation::scopedTimer instrumentationTimer(coordinateSystems::instrumentation::name)
+#else
+#define COORDINATESYSTEMS_COUNT(name, events) ((void)0)
+#define COORDINATESYSTEMS_ITERATIONS(iterations, altitude) ((void)(iterations))
+#define COORDINATESYSTEMS_TIME(name) ((void)0)
+#endif
+
+#endif	/* INSTRUMENTATION_H */
@@ -0,0 +1,393 @@
+/**
+ * @brief Local frame class definition.
+ * @file localFrame.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Reusable Earth-fixed local frame (origin and heading) that caches
+ * the origin ECF position, the ECF to East-North-Up (ENU) rotation and the
+ * heading rotation so that repeated conversions against a fixed site do not
+ * recompute the origin trigonometry.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef LOCALFRAME_H
+#define	LOCALFRAME_H
+
+#include "coordinateSystems.h"
+#include "frameTypes.h"
+#include "instrumentation.h"
+
+namespace coordinateSystems {
+
+/**
+ * @brief Earth-fixed local frame with cached origin data.
+ *
+ * Defined by an origin (LLA) and a heading measured from True North. The
+ * origin ECF position, the ECF to ENU rotation and the heading rotation are
+ * computed once at construction, so conversions against the frame only pay
+ * for the target coordinates. The ENU, DCA and AER instances it returns
+ * share the frame's registry entry.
+ *
+ * Coordinates passed to the frame are always interpreted in this frame; any
+ * origin or heading carried by an ENU, DCA or AER argument is ignored.
+*/
+class LocalFrame {
+public:
+/**
+ * @brief Local frame constructor.
+ * @param _origin: Defines origin for the frame (instance of LLA).
+ * @param _heading: Heading of the DCA/AER axes measured from True North in
+ * degrees (optional, default  = 0.0).
+ * @return class instance.
+ */
+    LocalFrame (LLA _origin, double _heading = 0.0);
+/**
+ * @brief Local frame constructor.
+ * @param _latitude: Latitude of the frame origin in degrees.
+ * @param _longitude: Longitude of the frame origin in degrees.
+ * @param _altitude: Altitude of the frame origin above a reference datum in
+ * meters.
+ * @param _heading: Heading of the DCA/AER axes measured from True North in
+ * degrees (optional, default  = 0.0).
+ * @return class instance.
+ */
+    LocalFrame (double _latitude, double _longitude, double _altitude, double _heading = 0.0);
+    ~LocalFrame();
+/**
+ * @brief Gets the origin of the frame.
+ * @return Instance of LLA.
+ */
+    LLA getOrigin(void);
+/**
+ * @brief Gets the cached ECF position of the frame origin.
+ * @return Instance of ECF.
+ */
+    ECF getOriginECF(void);
+/**
+ * @brief Gets the ECF to ENU rotation matrix.
+ * @param _rotation: Receives the matrix; rows are the East, North and Up unit
+ * vectors expressed in ECF.
+ * @return Nothing.
+ */
+    void getRotation(double _rotation[3][3]);
+/**
+ * @brief Gets the combined ECF to DCA rotation matrix.
+ * @param _rotation: Receives the matrix; rows are the DownRange, CrossRange
+ * and Above unit vectors expressed in ECF.
+ * @return Nothing.
+ */
+    void getDCARotation(double _rotation[3][3]);
+/**
+ * @brief Gets the ENU to DCA heading rotation matrix.
+ * @param _rotation: Receives the matrix; rows are the DownRange, CrossRange
+ * and Above unit vectors expressed in ENU.
+ * @return Nothing.
+ */
+    void getHeadingRotation(double _rotation[3][3]);
+/**
+ * @brief Sets the true heading of the frame and updates the cached heading
+ * and DCA rotations.
+ * @param _heading: Heading measured from True North in degrees.
+ * @return Nothing.
+ */
+    void setHeading(double _heading);
+/**
+ * @brief Gets the true heading of the frame.
+ * @return Heading measured from True North in degrees.
+ */
+    double getHeading(void);
+/**
+ * @brief Coordinate conversion from ECF to East-North-Up (ENU) system.
+ * @param _X: X coordinate in meters.
+ * @param _Y: Y coordinate in meters.
+ * @param _Z: Z coordinate in meters.
+ * @return Instance of ENU with the frame origin set.
+ */
+    ENU toENU(double _X, double _Y, double _Z);
+/**
+ * @brief Coordinate conversion from ECF to DownRange-CrossRange-Above (DCA)
+ * system.
+ * @param _X: X coordinate in meters.
+ * @param _Y: Y coordinate in meters.
+ * @param _Z: Z coordinate in meters.
+ * @return Instance of DCA with the frame origin and heading set.
+ */
+    DCA toDCA(double _X, double _Y, double _Z);
+/**
+ * @brief Coordinate conversion from ECF to Azimuth-Elevation-Range (AER)
+ * system.
+ * @param _X: X coordinate in meters.
+ * @param _Y: Y coordinate in meters.
+ * @param _Z: Z coordinate in meters.
+ * @return Instance of AER with the frame origin and heading set.
+ */
+    AER toAER(double _X, double _Y, double _Z);
+/**
+ * @brief Coordinate conversion to East-North-Up (ENU) system.
+ * @param _ecf: Position to convert (instance of ECF).
+ * @return Instance of ENU with the frame origin set.
+ */
+    ENU toENU(ECF _ecf);
+/**
+ * @brief Coordinate conversion to DownRange-CrossRange-Above (DCA) system.
+ * @param _ecf: Position to convert (instance of ECF).
+ * @return Instance of DCA with the frame origin and heading set.
+ */
+    DCA toDCA(ECF _ecf);
+/**
+ * @brief Coordinate conversion to Azimuth-Elevation-Range (AER) system.
+ * @param _ecf: Position to convert (instance of ECF).
+ * @return Instance of AER with the frame origin and heading set.
+ */
+    AER toAER(ECF _ecf);
+/**
+ * @brief Coordinate conversion to East-North-Up (ENU) system.
+ * @param _lla: Position to convert (instance of LLA).
+ * @return Instance of ENU with the frame origin set.
+ */
+    ENU toENU(LLA _lla);
+/**
+ * @brief Coordinate conversion to DownRange-CrossRange-Above (DCA) system.
+ * @param _lla: Position to convert (instance of LLA).
+ * @return Instance of DCA with the frame origin and heading set.
+ */
+    DCA toDCA(LLA _lla);
+/**
+ * @brief Coordinate conversion to Azimuth-Elevation-Range (AER) system.
+ * @param _lla: Position to convert (instance of LLA).
+ * @return Instance of AER with the frame origin and heading set.
+ */
+    AER toAER(LLA _lla);
+/**
+ * @brief Coordinate conversion to Earth-Centered-Fixed (ECF) system.
+ * @param _enu: Position in this frame (instance of ENU).
+ * @return Instance of ECF.
+ */
+    ECF toECF(ENU _enu);
+/**
+ * @brief Coordinate conversion to Earth-Centered-Fixed (ECF) system.
+ * @param _dca: Position in this frame (instance of DCA).
+ * @return Instance of ECF.
+ */
+    ECF toECF(DCA _dca);
+/**
+ * @brief Coordinate conversion to Earth-Centered-Fixed (ECF) system.
+ * @param _aer: Position in this frame (instance of AER).
+ * @return Instance of ECF.
+ */
+    ECF toECF(AER _aer);
+/**
+ * @brief Coordinate conversion to Latitude-Longitude-Altitude (LLA) system.
+ * @param _enu: Position in this frame (instance of ENU).
+ * @return Instance of LLA.
+ */
+    LLA toLLA(ENU _enu);
+/**
+ * @brief Coordinate conversion to Latitude-Longitude-Altitude (LLA) system.
+ * @param _dca: Position in this frame (instance of DCA).
+ * @return Instance of LLA.
+ */
+    LLA toLLA(DCA _dca);
+/**
+ * @brief Coordinate conversion to Latitude-Longitude-Altitude (LLA) system.
+ * @param _aer: Position in this frame (instance of AER).
+ * @return Instance of LLA.
+ */
+    LLA toLLA(AER _aer);
+/**
+ * @brief Coordinate conversion from ENU to DownRange-CrossRange-Above (DCA)
+ * system using the cached heading rotation.
+ * @param _enu: Position in this frame (instance of ENU).
+ * @return Instance of DCA with the frame origin and heading set.
+ */
+    DCA toDCA(ENU _enu);
+/**
+ * @brief Coordinate conversion from ENU to Azimuth-Elevation-Range (AER)
+ * system using the cached heading rotation.
+ * @param _enu: Position in this frame (instance of ENU).
+ * @return Instance of AER with the frame origin and heading set.
+ */
+    AER toAER(ENU _enu);
+/**
+ * @brief Coordinate conversion from DCA to East-North-Up (ENU) system using
+ * the cached heading rotation.
+ * @param _dca: Position in this frame (instance of DCA).
+ * @return Instance of ENU with the frame origin set.
+ */
+    ENU toENU(DCA _dca);
+/**
+ * @brief Coordinate conversion from AER to East-North-Up (ENU) system using
+ * the cached heading rotation.
+ * @param _aer: Position in this frame (instance of AER).
+ * @return Instance of ENU with the frame origin set.
+ */
+    ENU toENU(AER _aer);
+/**
+ * @brief Coordinate conversion from ECF to East-North-Up (ENU) system.
+ * @param _ecf: Position to convert.
+ * @return Position in this frame.
+ */
+    ENUVec toENU(ECFVec _ecf);
+/**
+ * @brief Coordinate conversion from ECF to DownRange-CrossRange-Above (DCA)
+ * system.
+ * @param _ecf: Position to convert.
+ * @return Position in this frame.
+ */
+    DCAVec toDCA(ECFVec _ecf);
+/**
+ * @brief Coordinate conversion from ECF to Azimuth-Elevation-Range (AER)
+ * system.
+ * @param _ecf: Position to convert.
+ * @return Position in this frame.
+ */
+    AERVec toAER(ECFVec _ecf);
+/**
+ * @brief Coordinate conversion to Earth-Centered-Fixed (ECF) system.
+ * @param _enu: Position in this frame.
+ * @return ECF position.
+ */
+    ECFVec toECF(ENUVec _enu);
+/**
+ * @brief Coordinate conversion to Earth-Centered-Fixed (ECF) system.
+ * @param _dca: Position in this frame.
+ * @return ECF position.
+ */
+    ECFVec toECF(DCAVec _dca);
+/**
+ * @brief Coordinate conversion to Earth-Centered-Fixed (ECF) system.
+ * @param _aer: Position in this frame.
+ * @return ECF position.
+ */
+    ECFVec toECF(AERVec _aer);
+/**
+ * @brief Coordinate conversion from ENU to DownRange-CrossRange-Above (DCA)
+ * system.
+ * @param _enu: Position in this frame.
+ * @return Position in this frame.
+ */
+    DCAVec toDCA(ENUVec _enu);
+/**
+ * @brief Coordinate conversion from ENU to Azimuth-Elevation-Range (AER)
+ * system.
+ * @param _enu: Position in this frame.
+ * @return Position in this frame.
+ */
+    AERVec toAER(ENUVec _enu);
+/**
+ * @brief Coordinate conversion from DCA to East-North-Up (ENU) system.
+ * @param _dca: Position in this frame.
+ * @return Position in this frame.
+ */
+    ENUVec toENU(DCAVec _dca);
+/**
+ * @brief Coordinate conversion from AER to East-North-Up (ENU) system.
+ * @param _aer: Position in this frame.
+ * @return Position in this frame.
+ */
+    ENUVec toENU(AERVec _aer);
+private:
+    LLA origin;
+    double heading;
+    double originX, originY, originZ; //cached origin ECF position
+    double rotation[3][3]; //ECF to ENU rotation, rows are E, N, U
+    double sinHeading, cosHeading; //cached heading rotation
+    double dcaRotation[3][3]; //ECF to DCA rotation, rows are D, C, A
+    frameHandle enuFrame, dcaFrame; //shared frames of the returned ENU and DCA/AER points
+    void initialize(void);
+};
+
+/*
+ * Value type conversions are inline so that loops over Vec3 arrays compile
+ * down to the cached rotations.
+ */
+inline ENUVec LocalFrame::toENU(ECFVec ecf){
+    COORDINATESYSTEMS_COUNT(COUNTER_TO_LOCAL,1);
+    double dx = ecf.first-originX;
+    double dy = ecf.second-originY;
+    double dz = ecf.third-originZ;
+
+    return ENUVec(rotation[0][0]*dx + rotation[0][1]*dy,
+            rotation[1][0]*dx + rotation[1][1]*dy + rotation[1][2]*dz,
+            rotation[2][0]*dx + rotation[2][1]*dy + rotation[2][2]*dz);
+}
+inline DCAVec LocalFrame::toDCA(ECFVec ecf){
+    COORDINATESYSTEMS_COUNT(COUNTER_TO_LOCAL,1);
+    double dx = ecf.first-originX;
+    double dy = ecf.second-originY;
+    double dz = ecf.third-originZ;
+
+    return DCAVec(dcaRotation[0][0]*dx + dcaRotation[0][1]*dy + dcaRotation[0][2]*dz,
+            dcaRotation[1][0]*dx + dcaRotation[1][1]*dy + dcaRotation[1][2]*dz,
+            dcaRotation[2][0]*dx + dcaRotation[2][1]*dy + dcaRotation[2][2]*dz);
+}
+inline AERVec LocalFrame::toAER(ECFVec ecf){
+    return coordinateSystems::toAER(this->toDCA(ecf));
+}
+inline ECFVec LocalFrame::toECF(ENUVec enu){
+    COORDINATESYSTEMS_COUNT(COUNTER_FROM_LOCAL,1);
+    return ECFVec(rotation[0][0]*enu.first + rotation[1][0]*enu.second + rotation[2][0]*enu.third + originX,
+            rotation[0][1]*enu.first + rotation[1][1]*enu.second + rotation[2][1]*enu.third + originY,
+            rotation[1][2]*enu.second + rotation[2][2]*enu.third + originZ);
+}
+inline ECFVec LocalFrame::toECF(DCAVec dca){
+    COORDINATESYSTEMS_COUNT(COUNTER_FROM_LOCAL,1);
+    return ECFVec(dcaRotation[0][0]*dca.first + dcaRotation[1][0]*dca.second + dcaRotation[2][0]*dca.third + originX,
+            dcaRotation[0][1]*dca.first + dcaRotation[1][1]*dca.second + dcaRotation[2][1]*dca.third + originY,
+            dcaRotation[0][2]*dca.first + dcaRotation[1][2]*dca.second + dcaRotation[2][2]*dca.third + originZ);
+}
+inline ECFVec LocalFrame::toECF(AERVec aer){
+    return this->toECF(coordinateSystems::toDCA(aer));
+}
+inline DCAVec LocalFrame::toDCA(ENUVec enu){
+    return DCAVec(enu.first*sinHeading + enu.second*cosHeading,
+            -enu.first*cosHeading + enu.second*sinHeading,
+            enu.third);
+}
+inline AERVec LocalFrame::toAER(ENUVec enu){
+    return coordinateSystems::toAER(this->toDCA(enu));
+}
+inline ENUVec LocalFrame::toENU(DCAVec dca){
+    return ENUVec(dca.first*sinHeading - dca.second*cosHeading,
+            dca.first*cosHeading + dca.second*sinHeading,
+            dca.third);
+}
+inline ENUVec LocalFrame::toENU(AERVec aer){
+    return this->toENU(coordinateSystems::toDCA(aer));
+}
+}
+#endif	/* LOCALFRAME_H */
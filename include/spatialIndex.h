@@ -0,0 +1,177 @@
+/**
+ * @brief Spatial index class definition.
+ * @file spatialIndex.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Uniform grid over ECF points answering range and elevation mask
+ * queries from a site without converting every point to AER.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef SPATIALINDEX_H
+#define	SPATIALINDEX_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+#include "coordinateSystems.h"
+#include "batchConversions.h"
+#include "localFrame.h"
+
+namespace coordinateSystems {
+
+/**
+ * @brief Uniform grid of ECF points answering range and visibility queries.
+ *
+ * Points are kept by caller-chosen identifiers in cubic ECF cells of a fixed
+ * edge length; only occupied cells are stored. A query first tests whole
+ * cells against the query region (a sphere around the site, or the cone
+ * above the elevation mask of a local frame) through their bounding boxes or
+ * spheres and only tests the points of cells that may intersect it, so the
+ * cost follows the number of nearby or visible points rather than the size
+ * of the index. Cells are spread over shards so that a build can fill them
+ * in parallel.
+ *
+ * Queries may run from several threads at once; insert, remove, build and
+ * clear must not overlap any other call.
+*/
+class SpatialIndex {
+public:
+/**
+ * @brief Spatial index constructor.
+ * @param _cellSize: Cell edge length in meters (optional, default  = 100 km).
+ * @return class instance with no points.
+ * @throw std::runtime_error if the cell size is not positive.
+ */
+    SpatialIndex (double _cellSize = 100000.0);
+    ~SpatialIndex();
+/**
+ * @brief Replaces the content of the index with a batch of points.
+ * @param _count: Number of points.
+ * @param _ecf: ECF points in meters; point i gets identifier i.
+ * @param _engine: Engine that fills the cells in parallel (optional,
+ * default  = NULL, build on the calling thread).
+ * @return Nothing.
+ */
+    void build(size_t _count, constCoordinateArray _ecf, BatchEngine *_engine = NULL);
+/**
+ * @brief Adds a point, or moves it if the identifier is already present.
+ * @param _id: Point identifier.
+ * @param _X: ECF x coordinate in meters.
+ * @param _Y: ECF y coordinate in meters.
+ * @param _Z: ECF z coordinate in meters.
+ * @return Nothing.
+ */
+    void insert(size_t _id, double _X, double _Y, double _Z);
+/**
+ * @brief Adds a point, or moves it if the identifier is already present.
+ * @param _id: Point identifier.
+ * @param _ecf: Position (instance of ECF).
+ * @return Nothing.
+ */
+    void insert(size_t _id, ECF _ecf);
+/**
+ * @brief Removes a point.
+ * @param _id: Point identifier.
+ * @return True if the point was present.
+ */
+    bool remove(size_t _id);
+/**
+ * @brief Removes all points.
+ * @return Nothing.
+ */
+    void clear(void);
+/**
+ * @brief Gets the number of points.
+ * @return Point count.
+ */
+    size_t size(void);
+/**
+ * @brief Gets the cell edge length.
+ * @return Cell size in meters.
+ */
+    double getCellSize(void);
+/**
+ * @brief Finds the points within a range of a site.
+ * @param _site: Site position (instance of ECF).
+ * @param _range: Range in meters.
+ * @param _ids: Receives the identifiers of the points at most _range from
+ * the site, in no particular order.
+ * @return Nothing.
+ */
+    void withinRange(ECF _site, double _range, std::vector<size_t> &_ids);
+/**
+ * @brief Finds the points above an elevation mask from a site.
+ * @param _site: Local frame at the site; the elevation is measured from its
+ * East-North plane as in the AER conversions.
+ * @param _elevation: Elevation mask in degrees.
+ * @param _ids: Receives the identifiers of the points at or above the mask
+ * elevation, in no particular order.
+ * @param _range: Maximum range in meters (optional, default  = no limit).
+ * @return Nothing.
+ */
+    void aboveElevation(LocalFrame &_site, double _elevation, std::vector<size_t> &_ids, double _range = HUGE_VAL);
+    static const size_t shardCount = 64;
+private:
+    struct cellKey {
+        int32_t x, y, z;
+        bool operator==(const cellKey &_other) const;
+    };
+    struct cellHash {
+        size_t operator()(const cellKey &_key) const;
+    };
+    struct entry {
+        size_t id;
+        double x, y, z;
+    };
+    typedef std::unordered_map<cellKey, std::vector<entry>, cellHash> cellMap;
+    struct shard {
+        cellMap cells;
+        std::unordered_map<size_t, cellKey> locations; //cell of every identifier of this shard
+    };
+    double cellSize;
+    std::vector<shard> shards; //cells by hash of the key, locations by identifier
+    cellKey keyOf(double _X, double _Y, double _Z);
+    size_t cellCount(void);
+    void add(size_t _id, const cellKey &_key, double _X, double _Y, double _Z);
+    template <class cellTest, class pointTest>
+    void query(double _X, double _Y, double _Z, double _range, cellTest _cellTest, pointTest _pointTest, std::vector<size_t> &_ids);
+};
+}
+#endif	/* SPATIALINDEX_H */
@@ -0,0 +1,179 @@
+/**
+ * @brief Velocity transformation definitions.
+ * @file velocityTransforms.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Batch conversions of positions and velocities together between the
+ * ECF, ENU, DCA and AER frames of a LocalFrame, and analytic azimuth,
+ * elevation and range rates.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef VELOCITYTRANSFORMS_H
+#define	VELOCITYTRANSFORMS_H
+
+#include <stddef.h>
+#include "batchConversions.h"
+#include "localFrame.h"
+
+namespace coordinateSystems {
+
+/*
+ * Position and velocity conversions: each call converts the positions as the
+ * batch position conversions do and applies the same cached frame rotation
+ * to the velocities. Velocities are in meters per second in ECF, ENU and
+ * DCA; in AER they are the azimuth and elevation rates in degrees per
+ * second and the range rate in meters per second. All frames are
+ * Earth-fixed, so an ECF velocity is relative to the rotating Earth. The
+ * AER rates are the DCA to AER Jacobian (see covarianceTransforms.h) times
+ * the DCA velocity, so they are zero for angles that are undefined at the
+ * position. Outputs may be the matching inputs.
+ */
+
+/**
+ * @brief Azimuth, elevation and range rates of a DCA position and velocity.
+ * @param _position: DCA position in meters.
+ * @param _velocity: DCA velocity in meters per second.
+ * @return Azimuth and elevation rates in degrees per second and range rate
+ * in meters per second.
+ */
+AERVec dcaToAERRates(DCAVec _position, DCAVec _velocity);
+/**
+ * @brief DCA velocity of an AER position and its rates.
+ * @param _position: AER position (degrees and meters).
+ * @param _rates: Azimuth and elevation rates in degrees per second and range
+ * rate in meters per second.
+ * @return DCA velocity in meters per second.
+ */
+DCAVec aerToDCARates(AERVec _position, AERVec _rates);
+
+/**
+ * @brief Batch position and velocity conversion from ECF to ENU.
+ * @param _count: Number of points.
+ * @param _positions: ECF positions.
+ * @param _velocities: ECF velocities.
+ * @param _outPositions: Receives the ENU positions.
+ * @param _outVelocities: Receives the ENU velocities.
+ * @param _frame: Frame (origin).
+ * @return Nothing.
+ */
+void ecfToENUVelocity(size_t _count, constCoordinateArray _positions, constCoordinateArray _velocities,
+        coordinateArray _outPositions, coordinateArray _outVelocities, LocalFrame &_frame);
+/**
+ * @brief Batch position and velocity conversion from ENU to ECF.
+ * @param _count: Number of points.
+ * @param _positions: ENU positions.
+ * @param _velocities: ENU velocities.
+ * @param _outPositions: Receives the ECF positions.
+ * @param _outVelocities: Receives the ECF velocities.
+ * @param _frame: Frame (origin).
+ * @return Nothing.
+ */
+void enuToECFVelocity(size_t _count, constCoordinateArray _positions, constCoordinateArray _velocities,
+        coordinateArray _outPositions, coordinateArray _outVelocities, LocalFrame &_frame);
+/**
+ * @brief Batch position and velocity conversion from ECF to DCA.
+ * @param _count: Number of points.
+ * @param _positions: ECF positions.
+ * @param _velocities: ECF velocities.
+ * @param _outPositions: Receives the DCA positions.
+ * @param _outVelocities: Receives the DCA velocities.
+ * @param _frame: Frame (origin and heading).
+ * @return Nothing.
+ */
+void ecfToDCAVelocity(size_t _count, constCoordinateArray _positions, constCoordinateArray _velocities,
+        coordinateArray _outPositions, coordinateArray _outVelocities, LocalFrame &_frame);
+/**
+ * @brief Batch position and velocity conversion from DCA to ECF.
+ * @param _count: Number of points.
+ * @param _positions: DCA positions.
+ * @param _velocities: DCA velocities.
+ * @param _outPositions: Receives the ECF positions.
+ * @param _outVelocities: Receives the ECF velocities.
+ * @param _frame: Frame (origin and heading).
+ * @return Nothing.
+ */
+void dcaToECFVelocity(size_t _count, constCoordinateArray _positions, constCoordinateArray _velocities,
+        coordinateArray _outPositions, coordinateArray _outVelocities, LocalFrame &_frame);
+/**
+ * @brief Batch position and rate conversion from DCA to AER.
+ * @param _count: Number of points.
+ * @param _positions: DCA positions.
+ * @param _velocities: DCA velocities.
+ * @param _outPositions: Receives the AER positions.
+ * @param _outRates: Receives the AER rates.
+ * @return Nothing.
+ */
+void dcaToAERVelocity(size_t _count, constCoordinateArray _positions, constCoordinateArray _velocities,
+        coordinateArray _outPositions, coordinateArray _outRates);
+/**
+ * @brief Batch position and rate conversion from AER to DCA.
+ * @param _count: Number of points.
+ * @param _positions: AER positions.
+ * @param _rates: AER rates.
+ * @param _outPositions: Receives the DCA positions.
+ * @param _outVelocities: Receives the DCA velocities.
+ * @return Nothing.
+ */
+void aerToDCAVelocity(size_t _count, constCoordinateArray _positions, constCoordinateArray _rates,
+        coordinateArray _outPositions, coordinateArray _outVelocities);
+/**
+ * @brief Batch position and rate conversion from ECF to AER.
+ * @param _count: Number of points.
+ * @param _positions: ECF positions.
+ * @param _velocities: ECF velocities.
+ * @param _outPositions: Receives the AER positions.
+ * @param _outRates: Receives the AER rates.
+ * @param _frame: Frame (origin and heading).
+ * @return Nothing.
+ */
+void ecfToAERVelocity(size_t _count, constCoordinateArray _positions, constCoordinateArray _velocities,
+        coordinateArray _outPositions, coordinateArray _outRates, LocalFrame &_frame);
+/**
+ * @brief Batch position and rate conversion from AER to ECF.
+ * @param _count: Number of points.
+ * @param _positions: AER positions.
+ * @param _rates: AER rates.
+ * @param _outPositions: Receives the ECF positions.
+ * @param _outVelocities: Receives the ECF velocities.
+ * @param _frame: Frame (origin and heading).
+ * @return Nothing.
+ */
+void aerToECFVelocity(size_t _count, constCoordinateArray _positions, constCoordinateArray _rates,
+        coordinateArray _outPositions, coordinateArray _outVelocities, LocalFrame &_frame);
+}
+#endif	/* VELOCITYTRANSFORMS_H */
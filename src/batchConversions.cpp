@@ -0,0 +1,416 @@
+/**
+ * @brief Batch coordinate conversion implementation.
+ * @file batchConversions.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Conversions between the coordinate systems of the class library
+ * applied to whole arrays of points held in caller-owned buffers, in either
+ * structure-of-arrays or strided array-of-structures layout. No per-point
+ * objects are constructed.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include <math.h>
+#include <algorithm>
+#include <bitset>
+#include <stdexcept>
+#include <vector>
+#include "batchConversions.h"
+#include "batchEngine.h"
+#include "geodeticKernels.h"
+#include "kernels.h"
+#include "instrumentation.h"
+
+using namespace coordinateSystems;
+
+static simdLevel detectSimdLevel(void){
+#ifdef COORDINATESYSTEMS_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SIMD_SSE2;
+    }
+#endif
+    return SIMD_NONE;
+}
+
+static const simdLevel supportedLevel = detectSimdLevel();
+static simdLevel currentLevel = supportedLevel;
+
+/***** SIMD level *************************************************************/
+simdLevel coordinateSystems::getSupportedSimdLevel(){
+    return supportedLevel;
+}
+simdLevel coordinateSystems::getSimdLevel(){
+    return currentLevel;
+}
+void coordinateSystems::setSimdLevel(simdLevel level){
+    currentLevel = (level > supportedLevel) ? supportedLevel : level;
+}
+#ifdef COORDINATESYSTEMS_X86_KERNELS
+template <class Kernel>
+static Kernel selectKernel(Kernel scalar, Kernel sse2, Kernel avx2, Kernel avx512){
+    switch (currentLevel) {
+    case SIMD_AVX512:
+        return avx512;
+    case SIMD_AVX2:
+        return avx2;
+    case SIMD_SSE2:
+        return sse2;
+    default:
+        return scalar;
+    }
+}
+#define KERNEL(name) selectKernel(kernels::name##Scalar,kernels::name##SSE2,kernels::name##AVX2,kernels::name##AVX512)
+#else
+#define KERNEL(name) kernels::name##Scalar
+#endif
+/***** scalar kernels *********************************************************/
+void kernels::ecfToLLAScalar(size_t count, const double *x, const double *y, const double *z, size_t inStride,
+        double *latitude, double *longitude, double *altitude, size_t outStride, double a, double e2){
+    size_t i, j, k;
+    if (e2 == 0.0) {
+        for (i = 0, j = 0, k = 0; i < count; i++, j += inStride, k += outStride) {
+            ecfToLLASpherical(x[j],y[j],z[j],a,latitude[k],longitude[k],altitude[k]);
+        }
+    } else {
+        for (i = 0, j = 0, k = 0; i < count; i++, j += inStride, k += outStride) {
+            ecfToLLAClosedForm(x[j],y[j],z[j],a,e2,latitude[k],longitude[k],altitude[k]);
+        }
+    }
+}
+void kernels::llaToECFScalar(size_t count, const double *latitude, const double *longitude, const double *altitude,
+        size_t inStride, double *x, double *y, double *z, size_t outStride, double a, double e2){
+    size_t i, j, k;
+    if (e2 == 0.0) {
+        for (i = 0, j = 0, k = 0; i < count; i++, j += inStride, k += outStride) {
+            llaToECFSpherical(latitude[j],longitude[j],altitude[j],a,x[k],y[k],z[k]);
+        }
+    } else {
+        for (i = 0, j = 0, k = 0; i < count; i++, j += inStride, k += outStride) {
+            llaToECFSinCos(latitude[j],longitude[j],altitude[j],a,e2,x[k],y[k],z[k]);
+        }
+    }
+}
+void kernels::toLocalScalar(size_t count, const double *first, const double *second, const double *third, size_t inStride,
+        double *outFirst, double *outSecond, double *outThird, size_t outStride, const frameConstants &frame,
+        bool fromLLA, bool toAER){
+    convertFrame<double,toLocalOperation>(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,
+            frame,fromLLA,toAER);
+}
+void kernels::fromLocalScalar(size_t count, const double *first, const double *second, const double *third, size_t inStride,
+        double *outFirst, double *outSecond, double *outThird, size_t outStride, const frameConstants &frame,
+        bool fromAER, bool toLLA){
+    convertFrame<double,fromLocalOperation>(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,
+            frame,fromAER,toLLA);
+}
+void kernels::visibilityScalar(size_t count, const double *x, const double *y, const double *z, size_t stride,
+        const frameConstants &frame, const visibilityConstants &limits, uint64_t *clear, uint64_t *ambiguous){
+    size_t i, j;
+    unsigned high, low;
+
+    for (i = 0; i < (count+63)/64; i++) {
+        clear[i] = 0;
+        ambiguous[i] = 0;
+    }
+    for (i = 0, j = 0; i < count; i++, j += stride) {
+        visibilityTest(x[j],y[j],z[j],frame,limits,high,low);
+        clear[i/64] |= (uint64_t) high << (i%64);
+        ambiguous[i/64] |= (uint64_t) (low & ~high) << (i%64);
+    }
+}
+/***** fused kernel helpers ***************************************************/
+/*
+ * Frame constants for the cached local axes of a frame: ENU, or DCA with the
+ * heading rotation folded in.
+ */
+static kernels::frameConstants localConstants(LocalFrame &frame, bool dca){
+    kernels::frameConstants constants;
+
+    ECF originECF = frame.getOriginECF();
+    constants.origin[0] = originECF.getFirstCoordinate();
+    constants.origin[1] = originECF.getSecondCoordinate();
+    constants.origin[2] = originECF.getThirdCoordinate();
+    if (dca) {
+        frame.getDCARotation(constants.rotation);
+    } else {
+        frame.getRotation(constants.rotation);
+    }
+    constants.a = earthCentered::a;
+    constants.e2 = earthCentered::e2;
+    return constants;
+}
+/*
+ * Frame constants for a rotation about a zero origin: the ENU to DCA heading
+ * rotation of a frame or of a bare heading, or the identity (DCA to AER).
+ */
+static kernels::frameConstants headingConstants(LocalFrame &frame){
+    kernels::frameConstants constants = {{0.0, 0.0, 0.0}, {{0.0}}, earthCentered::a, earthCentered::e2};
+    frame.getHeadingRotation(constants.rotation);
+    return constants;
+}
+static kernels::frameConstants headingConstants(double heading){
+    double sinHeading = sin(heading*deg2rad);
+    double cosHeading = cos(heading*deg2rad);
+    kernels::frameConstants constants = {{0.0, 0.0, 0.0},
+        {{sinHeading, cosHeading, 0.0}, {-cosHeading, sinHeading, 0.0}, {0.0, 0.0, 1.0}},
+        earthCentered::a, earthCentered::e2};
+    return constants;
+}
+static const kernels::frameConstants identityConstants = {{0.0, 0.0, 0.0},
+    {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+    earthCentered::a, earthCentered::e2};
+static void toLocal(size_t count, constCoordinateArray in, coordinateArray out, const kernels::frameConstants &frame,
+        bool fromLLA, bool toAER){
+    COORDINATESYSTEMS_TIME(TIMER_BATCH_CALL);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    KERNEL(toLocal)(count,in.first,in.second,in.third,in.stride,out.first,out.second,out.third,out.stride,
+            frame,fromLLA,toAER);
+}
+static void fromLocal(size_t count, constCoordinateArray in, coordinateArray out, const kernels::frameConstants &frame,
+        bool fromAER, bool toLLA){
+    COORDINATESYSTEMS_TIME(TIMER_BATCH_CALL);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    KERNEL(fromLocal)(count,in.first,in.second,in.third,in.stride,out.first,out.second,out.third,out.stride,
+            frame,fromAER,toLLA);
+}
+
+/***** coordinateArray ********************************************************/
+coordinateArray::coordinateArray(double *f, double *s, double *t, size_t n) :
+first(f), second(s), third(t), stride(n){
+}
+coordinateArray::coordinateArray(double *interleaved) :
+first(interleaved), second(interleaved+1), third(interleaved+2), stride(3){
+}
+/***** constCoordinateArray ***************************************************/
+constCoordinateArray::constCoordinateArray(const double *f, const double *s, const double *t, size_t n) :
+first(f), second(s), third(t), stride(n){
+}
+constCoordinateArray::constCoordinateArray(const double *interleaved) :
+first(interleaved), second(interleaved+1), third(interleaved+2), stride(3){
+}
+constCoordinateArray::constCoordinateArray(const coordinateArray &array) :
+first(array.first), second(array.second), third(array.third), stride(array.stride){
+}
+/***** single conversions *****************************************************/
+void coordinateSystems::ecfToLLA(size_t count, constCoordinateArray in, coordinateArray out){
+    ecfToLLA(count,in,out,earthCentered::a,earthCentered::e2);
+}
+void coordinateSystems::ecfToLLA(size_t count, constCoordinateArray in, coordinateArray out, double a, double e2){
+    COORDINATESYSTEMS_TIME(TIMER_BATCH_CALL);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    KERNEL(ecfToLLA)(count,in.first,in.second,in.third,in.stride,out.first,out.second,out.third,out.stride,a,e2);
+}
+void coordinateSystems::llaToECF(size_t count, constCoordinateArray in, coordinateArray out){
+    llaToECF(count,in,out,earthCentered::a,earthCentered::e2);
+}
+void coordinateSystems::llaToECF(size_t count, constCoordinateArray in, coordinateArray out, double a, double e2){
+    COORDINATESYSTEMS_TIME(TIMER_BATCH_CALL);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    KERNEL(llaToECF)(count,in.first,in.second,in.third,in.stride,out.first,out.second,out.third,out.stride,a,e2);
+}
+void coordinateSystems::ecfToENU(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    toLocal(count,in,out,localConstants(frame,false),false,false);
+}
+void coordinateSystems::enuToECF(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    fromLocal(count,in,out,localConstants(frame,false),false,false);
+}
+void coordinateSystems::enuToDCA(size_t count, constCoordinateArray in, coordinateArray out, double heading){
+    toLocal(count,in,out,headingConstants(heading),false,false);
+}
+void coordinateSystems::dcaToENU(size_t count, constCoordinateArray in, coordinateArray out, double heading){
+    fromLocal(count,in,out,headingConstants(heading),false,false);
+}
+void coordinateSystems::enuToDCA(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    toLocal(count,in,out,headingConstants(frame),false,false);
+}
+void coordinateSystems::dcaToENU(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    fromLocal(count,in,out,headingConstants(frame),false,false);
+}
+void coordinateSystems::dcaToAER(size_t count, constCoordinateArray in, coordinateArray out){
+    toLocal(count,in,out,identityConstants,false,true);
+}
+void coordinateSystems::aerToDCA(size_t count, constCoordinateArray in, coordinateArray out){
+    fromLocal(count,in,out,identityConstants,true,false);
+}
+/***** fused conversions ****************************************************/
+void coordinateSystems::ecfToDCA(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    toLocal(count,in,out,localConstants(frame,true),false,false);
+}
+void coordinateSystems::ecfToAER(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    toLocal(count,in,out,localConstants(frame,true),false,true);
+}
+void coordinateSystems::llaToENU(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    toLocal(count,in,out,localConstants(frame,false),true,false);
+}
+void coordinateSystems::llaToDCA(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    toLocal(count,in,out,localConstants(frame,true),true,false);
+}
+void coordinateSystems::llaToAER(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    toLocal(count,in,out,localConstants(frame,true),true,true);
+}
+void coordinateSystems::enuToLLA(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    fromLocal(count,in,out,localConstants(frame,false),false,true);
+}
+void coordinateSystems::enuToAER(size_t count, constCoordinateArray in, coordinateArray out, double heading){
+    toLocal(count,in,out,headingConstants(heading),false,true);
+}
+void coordinateSystems::enuToAER(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    toLocal(count,in,out,headingConstants(frame),false,true);
+}
+void coordinateSystems::dcaToECF(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    fromLocal(count,in,out,localConstants(frame,true),false,false);
+}
+void coordinateSystems::dcaToLLA(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    fromLocal(count,in,out,localConstants(frame,true),false,true);
+}
+void coordinateSystems::aerToENU(size_t count, constCoordinateArray in, coordinateArray out, double heading){
+    fromLocal(count,in,out,headingConstants(heading),true,false);
+}
+void coordinateSystems::aerToENU(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    fromLocal(count,in,out,headingConstants(frame),true,false);
+}
+void coordinateSystems::aerToECF(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    fromLocal(count,in,out,localConstants(frame,true),true,false);
+}
+void coordinateSystems::aerToLLA(size_t count, constCoordinateArray in, coordinateArray out, LocalFrame &frame){
+    fromLocal(count,in,out,localConstants(frame,true),true,true);
+}
+/***** look-angle matrices ****************************************************/
+void coordinateSystems::ecfToAERMatrix(size_t sensorCount, LocalFrame *sensors, size_t targetCount, constCoordinateArray targets,
+        coordinateArray out, BatchEngine *engine){
+    std::vector<kernels::frameConstants> frames(sensorCount);
+
+    for (size_t s = 0; s < sensorCount; s++) {
+        frames[s] = localConstants(sensors[s],true);
+    }
+    //every sensor converts one block of targets while it is in the L1 cache
+    auto sweep = [&](size_t begin, size_t end){
+        for (size_t block = begin; block < end; block += lookAngleBlock) {
+            size_t n = std::min(lookAngleBlock,end - block);
+            size_t in = block*targets.stride;
+            constCoordinateArray blockTargets(targets.first + in,targets.second + in,targets.third + in,targets.stride);
+            for (size_t s = 0; s < sensorCount; s++) {
+                size_t row = (s*targetCount + block)*out.stride;
+                toLocal(n,blockTargets,coordinateArray(out.first + row,out.second + row,out.third + row,out.stride),
+                        frames[s],false,true);
+            }
+        }
+    };
+    if (engine != NULL) {
+        engine->run(targetCount,sweep);
+    } else {
+        sweep(0,targetCount);
+    }
+}
+void coordinateSystems::llaToAERMatrix(size_t sensorCount, LocalFrame *sensors, size_t targetCount, constCoordinateArray targets,
+        coordinateArray out, BatchEngine *engine){
+    std::vector<double> ecf(3*targetCount);
+
+    if (engine != NULL) {
+        engine->run(targetCount,targets,coordinateArray(ecf.data()),llaToECF);
+    } else {
+        llaToECF(targetCount,targets,coordinateArray(ecf.data()));
+    }
+    ecfToAERMatrix(sensorCount,sensors,targetCount,constCoordinateArray(ecf.data()),out,engine);
+}
+/***** visibility *************************************************************/
+size_t coordinateSystems::ecfVisibility(size_t count, constCoordinateArray targets, LocalFrame &sensor, double elevation,
+        double maxRange, uint64_t *visible){
+    return ecfVisibility(count,targets,sensor,1,&elevation,maxRange,visible);
+}
+size_t coordinateSystems::ecfVisibility(size_t count, constCoordinateArray targets, LocalFrame &sensor, size_t sectorCount,
+        const double *elevations, double maxRange, uint64_t *visible){
+    const size_t blockWords = 64; //words of ambiguous bits per kernel call
+    kernels::frameConstants frame = localConstants(sensor,true);
+    kernels::visibilityConstants limits;
+    uint64_t ambiguous[blockWords];
+    size_t words = (count+63)/64, visibleCount = 0;
+
+    if (sectorCount == 0) {
+        throw std::runtime_error("Visibility mask has no azimuth sectors");
+    }
+    //the sine is increasing over the elevations, so the extreme masks give the extreme sines
+    limits.range2 = maxRange*maxRange;
+    limits.sinLow = sin(*std::min_element(elevations,elevations+sectorCount)*kernels::radPerDeg);
+    limits.sinHigh = sin(*std::max_element(elevations,elevations+sectorCount)*kernels::radPerDeg);
+
+    COORDINATESYSTEMS_TIME(TIMER_BATCH_CALL);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    for (size_t first = 0; first < words; first += blockWords) {
+        size_t begin = first*64, n = std::min(count - begin,blockWords*64);
+        size_t in = begin*targets.stride;
+        KERNEL(visibility)(n,targets.first + in,targets.second + in,targets.third + in,targets.stride,frame,limits,
+                visible + first,ambiguous);
+        //targets between the lowest and highest mask: the azimuth picks the sector
+        for (size_t word = first; word < std::min(words,first + blockWords); word++) {
+            uint64_t bits = ambiguous[word - first];
+            for (size_t lane = 0; bits != 0; lane++, bits >>= 1) {
+                if (!(bits & 1)) {
+                    continue;
+                }
+                size_t i = word*64 + lane;
+                double downRange, crossRange, above;
+                kernels::rotateToLocal(targets.first[i*targets.stride],targets.second[i*targets.stride],
+                        targets.third[i*targets.stride],frame.origin,frame.rotation,downRange,crossRange,above);
+                double azimuth = atan2(-crossRange,downRange)*kernels::degPerRad;
+                if (azimuth < 0) {
+                    azimuth += 360.0;
+                }
+                size_t sector = std::min((size_t) (azimuth*sectorCount/360.0),sectorCount-1);
+                double sinMask = sin(elevations[sector]*kernels::radPerDeg);
+                double range = sqrt(downRange*downRange + crossRange*crossRange + above*above);
+                //the origin has zero elevation, as in ecfToAER
+                if (above >= range*sinMask && (range > 0 || sinMask <= 0)) {
+                    visible[word] |= (uint64_t) 1 << lane;
+                }
+            }
+            visibleCount += std::bitset<64>(visible[word]).count();
+        }
+    }
+    return visibleCount;
+}
@@ -0,0 +1,210 @@
+/**
+ * @brief Parallel batch engine class implementation.
+ * @file batchEngine.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Thread pool that splits batch conversions into fixed chunks and
+ * balances them across threads by work stealing.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include "batchEngine.h"
+
+using namespace coordinateSystems;
+
+/***** BatchEngine ************************************************************/
+BatchEngine::BatchEngine(unsigned maxThreads, size_t size) : chunkSize(size ? size : 1),
+taskCount(0), generation(0), active(0), stopping(false), remaining(0){
+    unsigned count = maxThreads ? maxThreads : std::thread::hardware_concurrency();
+    if (count == 0) {
+        count = 1;
+    }
+    queues = std::vector<chunkQueue>(count);
+    for (unsigned i = 0; i < count; i++) {
+        queues[i].begin = queues[i].end = 0;
+    }
+    for (unsigned i = 1; i < count; i++) {
+        threads.push_back(std::thread(&BatchEngine::workerLoop,this,i));
+    }
+}
+BatchEngine::~BatchEngine(){
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
+unsigned BatchEngine::getThreadCount(){
+    return (unsigned)queues.size();
+}
+size_t BatchEngine::getChunkSize(){
+    return chunkSize;
+}
+void BatchEngine::run(size_t count, constCoordinateArray in, coordinateArray out, conversion convert){
+    this->run(count,[&](size_t begin, size_t end){
+        convert(end-begin,
+                constCoordinateArray(in.first+begin*in.stride,in.second+begin*in.stride,in.third+begin*in.stride,in.stride),
+                coordinateArray(out.first+begin*out.stride,out.second+begin*out.stride,out.third+begin*out.stride,out.stride));
+    });
+}
+void BatchEngine::run(size_t count, constCoordinateArray in, coordinateArray out, frameConversion convert, LocalFrame &frame){
+    this->run(count,[&](size_t begin, size_t end){
+        convert(end-begin,
+                constCoordinateArray(in.first+begin*in.stride,in.second+begin*in.stride,in.third+begin*in.stride,in.stride),
+                coordinateArray(out.first+begin*out.stride,out.second+begin*out.stride,out.third+begin*out.stride,out.stride),
+                frame);
+    });
+}
+void BatchEngine::run(size_t count, constCoordinateArray in, coordinateArray out, headingConversion convert, double heading){
+    this->run(count,[&](size_t begin, size_t end){
+        convert(end-begin,
+                constCoordinateArray(in.first+begin*in.stride,in.second+begin*in.stride,in.third+begin*in.stride,in.stride),
+                coordinateArray(out.first+begin*out.stride,out.second+begin*out.stride,out.third+begin*out.stride,out.stride),
+                heading);
+    });
+}
+void BatchEngine::run(size_t count, const std::function<void(size_t, size_t)> &function){
+    std::lock_guard<std::mutex> serialize(runLock);
+    size_t chunks = (count + chunkSize - 1)/chunkSize;
+    size_t share = queues.size();
+    std::exception_ptr failure;
+
+    if (count == 0) {
+        return;
+    }
+    if (chunks == 1 || share == 1) {
+        function(0,count);
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        //late workers of the previous run may still be looking for chunks
+        done.wait(guard,[this]{ return active == 0; });
+        task = function;
+        taskCount = count;
+        error = nullptr;
+        remaining = chunks;
+        for (size_t i = 0; i < share; i++) {
+            std::lock_guard<std::mutex> queueGuard(queues[i].lock);
+            queues[i].begin = i*chunks/share;
+            queues[i].end = (i+1)*chunks/share;
+        }
+        generation++;
+    }
+    wake.notify_all();
+
+    this->execute(0);
+
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        done.wait(guard,[this]{ return remaining == 0 && active == 0; });
+        task = nullptr;
+        failure = error;
+        error = nullptr;
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+void BatchEngine::workerLoop(unsigned index){
+    unsigned seen = 0;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard,[&]{ return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+            active++;
+        }
+
+        this->execute(index);
+
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            active--;
+        }
+        done.notify_all();
+    }
+}
+bool BatchEngine::takeChunk(unsigned index, size_t &chunk){
+    size_t share = queues.size();
+
+    {
+        std::lock_guard<std::mutex> guard(queues[index].lock);
+        if (queues[index].begin < queues[index].end) {
+            chunk = queues[index].begin++;
+            return true;
+        }
+    }
+    //own share done, steal from the back of another
+    for (size_t i = 1; i < share; i++) {
+        chunkQueue &victim = queues[(index+i) % share];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (victim.begin < victim.end) {
+            chunk = --victim.end;
+            return true;
+        }
+    }
+    return false;
+}
+void BatchEngine::execute(unsigned index){
+    size_t chunk, begin, end;
+
+    while (this->takeChunk(index,chunk)) {
+        begin = chunk*chunkSize;
+        end = (begin + chunkSize < taskCount) ? begin + chunkSize : taskCount;
+        try {
+            task(begin,end);
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(lock);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        if (--remaining == 0) {
+            std::lock_guard<std::mutex> guard(lock);
+            done.notify_all();
+        }
+    }
+}
@@ -0,0 +1,268 @@
+/**
+ * @brief Memory-mapped bulk conversion implementation.
+ * @file bulkConversions.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Maps point files with mmap, converts them chunk by chunk through
+ * the batch conversions, optionally on a BatchEngine, and hints the kernel
+ * with madvise to read ahead and to release converted input pages.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include "bulkConversions.h"
+
+using namespace coordinateSystems;
+
+/***** mapped files ***********************************************************/
+namespace {
+
+typedef std::function<void(size_t, constCoordinateArray, coordinateArray)> chunkConversion;
+
+const size_t pointBytes = 3*sizeof(double);
+
+void fail(const char *action, const std::string &path){
+    throw std::runtime_error(std::string("Cannot ") + action + " " + path + ": " + strerror(errno));
+}
+
+//file descriptor and mapping released on scope exit
+struct mappedFile {
+    int descriptor;
+    void *data;
+    size_t size;
+    dev_t device;
+    ino_t inode;
+    bool created; //opened with O_CREAT and did not exist before
+    mappedFile() : descriptor(-1), data(NULL), size(0), device(0), inode(0), created(false){
+    }
+    ~mappedFile(){
+        if (data != NULL) {
+            munmap(data,size);
+        }
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+    }
+    void open(const std::string &path, int flags){
+        struct stat status;
+        if (flags & O_CREAT) {
+            descriptor = ::open(path.c_str(),flags | O_EXCL,0644);
+            created = (descriptor >= 0);
+        }
+        if (descriptor < 0) {
+            descriptor = ::open(path.c_str(),flags & ~O_CREAT,0644);
+        }
+        if (descriptor < 0) {
+            fail("open",path);
+        }
+        if (fstat(descriptor,&status) != 0) {
+            fail("stat",path);
+        }
+        size = (size_t)status.st_size;
+        device = status.st_dev;
+        inode = status.st_ino;
+    }
+    void map(const std::string &path, int protection){
+        if (size == 0) {
+            return;
+        }
+        data = mmap(NULL,size,protection,MAP_SHARED,descriptor,0);
+        if (data == MAP_FAILED) {
+            data = NULL;
+            fail("map",path);
+        }
+    }
+    //writes the mapping back so that write errors are reported here
+    void sync(const std::string &path){
+        if (data != NULL && msync(data,size,MS_SYNC) != 0) {
+            fail("write",path);
+        }
+    }
+};
+
+//madvise over the pages covering [begin, end) bytes; inward rounding releases only whole pages
+//returns the rounded end of the advised range
+size_t advise(void *data, size_t begin, size_t end, int advice, bool inward){
+    static const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    if (inward) {
+        begin = (begin + page - 1)/page*page;
+        end = end/page*page;
+    } else {
+        begin = begin/page*page;
+    }
+    if (end <= begin) {
+        return begin;
+    }
+    madvise((char*)data + begin,end - begin,advice);
+    return end;
+}
+
+/*
+ * Converts count points from input to output chunk by chunk, asking for the
+ * next chunk to be read ahead before converting the current one and, when
+ * the output is a separate file, releasing converted input pages.
+ */
+size_t convertMapped(double *input, double *output, size_t count, const chunkConversion &convert,
+        BatchEngine *engine, size_t chunkPoints){
+    size_t chunk = std::max(chunkPoints,(size_t)1);
+    //give every engine thread at least one engine chunk per file chunk
+    if (engine != NULL) {
+        chunk = std::max(chunk,engine->getThreadCount()*engine->getChunkSize());
+    }
+    bool separate = (input != output);
+    size_t released = 0; //input bytes already released, a whole number of pages
+
+    if (count == 0) {
+        return 0;
+    }
+    advise(input,0,count*pointBytes,MADV_SEQUENTIAL,false);
+    advise(input,0,std::min(chunk,count)*pointBytes,MADV_WILLNEED,false);
+    for (size_t begin = 0; begin < count; begin += chunk) {
+        size_t n = std::min(chunk,count - begin);
+        if (begin + n < count) {
+            advise(input,(begin + n)*pointBytes,std::min(begin + n + chunk,count)*pointBytes,MADV_WILLNEED,false);
+        }
+        double *in = input + 3*begin;
+        double *out = output + 3*begin;
+        if (engine != NULL) {
+            engine->run(n,[&](size_t first, size_t last){
+                convert(last - first,constCoordinateArray(in + 3*first),coordinateArray(out + 3*first));
+            });
+        } else {
+            convert(n,constCoordinateArray(in),coordinateArray(out));
+        }
+        if (separate) {
+            released = advise(input,released,(begin + n)*pointBytes,MADV_DONTNEED,true);
+        }
+    }
+    return count;
+}
+
+size_t convertInPlace(const std::string &path, const chunkConversion &convert, BatchEngine *engine, size_t chunkPoints);
+
+size_t convertToFile(const std::string &inputPath, const std::string &outputPath, const chunkConversion &convert,
+        BatchEngine *engine, size_t chunkPoints){
+    mappedFile input, output;
+
+    input.open(inputPath,O_RDONLY);
+    if (input.size % pointBytes != 0) {
+        throw std::runtime_error("Cannot convert " + inputPath + ": size is not a multiple of 24 bytes.");
+    }
+    input.map(inputPath,PROT_READ);
+    //not truncated until it is known not to be the input under another name
+    output.open(outputPath,O_RDWR | O_CREAT);
+    if (output.device == input.device && output.inode == input.inode) {
+        return convertInPlace(inputPath,convert,engine,chunkPoints);
+    }
+    try {
+        //blocks are reserved up front: a full disk would otherwise raise SIGBUS on a mapped write
+        if (ftruncate(output.descriptor,(off_t)input.size) != 0) {
+            fail("resize",outputPath);
+        }
+        if (input.size > 0 && (errno = posix_fallocate(output.descriptor,0,(off_t)input.size)) != 0) {
+            fail("allocate",outputPath);
+        }
+        output.size = input.size;
+        output.map(outputPath,PROT_READ | PROT_WRITE);
+        size_t count = convertMapped((double*)input.data,(double*)output.data,input.size/pointBytes,convert,engine,
+                chunkPoints);
+        output.sync(outputPath);
+        return count;
+    } catch (...) {
+        if (output.created) {
+            unlink(outputPath.c_str());
+        }
+        throw;
+    }
+}
+
+size_t convertInPlace(const std::string &path, const chunkConversion &convert, BatchEngine *engine, size_t chunkPoints){
+    mappedFile file;
+
+    file.open(path,O_RDWR);
+    if (file.size % pointBytes != 0) {
+        throw std::runtime_error("Cannot convert " + path + ": size is not a multiple of 24 bytes.");
+    }
+    file.map(path,PROT_READ | PROT_WRITE);
+    size_t count = convertMapped((double*)file.data,(double*)file.data,file.size/pointBytes,convert,engine,chunkPoints);
+    file.sync(path);
+    return count;
+}
+
+}
+
+/***** bulk conversions *******************************************************/
+size_t coordinateSystems::convertFile(const std::string &input, const std::string &output, BatchEngine::conversion conversion,
+        BatchEngine *engine, size_t chunkPoints){
+    return convertToFile(input,output,conversion,engine,chunkPoints);
+}
+size_t coordinateSystems::convertFile(const std::string &input, const std::string &output, BatchEngine::frameConversion conversion,
+        LocalFrame &frame, BatchEngine *engine, size_t chunkPoints){
+    return convertToFile(input,output,[&](size_t count, constCoordinateArray in, coordinateArray out){
+        conversion(count,in,out,frame);
+    },engine,chunkPoints);
+}
+size_t coordinateSystems::convertFile(const std::string &input, const std::string &output, BatchEngine::headingConversion conversion,
+        double heading, BatchEngine *engine, size_t chunkPoints){
+    return convertToFile(input,output,[&](size_t count, constCoordinateArray in, coordinateArray out){
+        conversion(count,in,out,heading);
+    },engine,chunkPoints);
+}
+size_t coordinateSystems::convertFile(const std::string &path, BatchEngine::conversion conversion,
+        BatchEngine *engine, size_t chunkPoints){
+    return convertInPlace(path,conversion,engine,chunkPoints);
+}
+size_t coordinateSystems::convertFile(const std::string &path, BatchEngine::frameConversion conversion,
+        LocalFrame &frame, BatchEngine *engine, size_t chunkPoints){
+    return convertInPlace(path,[&](size_t count, constCoordinateArray in, coordinateArray out){
+        conversion(count,in,out,frame);
+    },engine,chunkPoints);
+}
+size_t coordinateSystems::convertFile(const std::string &path, BatchEngine::headingConversion conversion,
+        double heading, BatchEngine *engine, size_t chunkPoints){
+    return convertInPlace(path,[&](size_t count, constCoordinateArray in, coordinateArray out){
+        conversion(count,in,out,heading);
+    },engine,chunkPoints);
+}
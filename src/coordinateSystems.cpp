@@ -1,8 +1,8 @@
 /**
  * @brief Coordinate systems class library implementation.
  * @file coordinateSystems.cpp
- * @version 19.09
- * @date September 24, 2019
+ * @version 26.10
+ * @date October 17, 2026
  * @details Library of classes representing various coordinate systems and
  * providing the transformations between them. Coordinate systems represented
  * are: East-North-Up (ENU), Downrange-Crossrange-Above (DCA), Latitude-
@@ -14,6 +14,7 @@
  * Version 1.0 on January 13, 2014
  * Version 1.4 on June 6, 2014
  * Version 19.09 on September 24, 2019
+ * Version 26.10 on October 17, 2026
  */
 
  /**
@@ -50,9 +51,127 @@
 
 #include <math.h>
 #include "coordinateSystems.h"
+#include "conversionKernels.h"
+#include "instrumentation.h"
 
 using namespace coordinateSystems;
 
+/***** geodetic helpers *******************************************************/
+/*
+ * Bowring's method for ECF to LLA: iterate on the reduced latitude, which
+ * converges cubically, so one iteration is sub-millimetre near the surface
+ * and two reach round-off everywhere. The reduced and geodetic latitudes are
+ * carried as sine/cosine pairs so each iteration is one square root and no
+ * trigonometry. Stops after the given number of iterations or once the
+ * latitude changes by less than tol radians. Returns the iterations used.
+ */
+static unsigned bowringToLLA(double x, double y, double z, unsigned iterations, double tol,
+        double &latitude, double &longitude, double &altitude){
+    const double a = WGS84::a;
+    const double e2 = WGS84::e2;
+    const double ratio = WGS84::ratio;
+    const double b = WGS84::b;
+    const double ep2 = WGS84::ep2;
+    const double aE2 = WGS84::aE2;
+    double p = sqrt(x*x+y*y);
+    double norm = sqrt(z*z + p*ratio*p*ratio);
+    double sinBeta = (norm > 0) ? z/norm : 0.0;
+    double cosBeta = (norm > 0) ? p*ratio/norm : 1.0;
+    double sinLat = sinBeta, cosLat = cosBeta;
+    double num = z, den = p;
+    unsigned i;
+
+    for (i = 0; i < iterations; i++) {
+        double previousSin = sinLat, previousCos = cosLat;
+        num = z + ep2*b*sinBeta*sinBeta*sinBeta;
+        den = p - aE2*cosBeta*cosBeta*cosBeta;
+        norm = sqrt(num*num + den*den);
+        sinLat = num/norm;
+        cosLat = den/norm;
+        if (fabs(sinLat*previousCos - cosLat*previousSin) < tol) {
+            i++;
+            break;
+        }
+        norm = sqrt(ratio*num*ratio*num + den*den);
+        sinBeta = ratio*num/norm;
+        cosBeta = den/norm;
+    }
+
+    altitude = p*cosLat + z*sinLat - a*sqrt(1-e2*sinLat*sinLat);
+    latitude = atan2(num,den)*kernels::degPerRad;
+    longitude = atan2(y,x)*kernels::degPerRad;
+    return i;
+}
+/*
+ * Original fixed-point iteration on the geodetic latitude, stopped once the
+ * latitude changes by less than latTol radians. Returns the iterations used.
+ */
+static unsigned iterativeToLLA(double x, double y, double z, double &latitude, double &longitude, double &altitude){
+    double p = sqrt(pow(x,2)+pow(y,2));
+    double lat,N;
+    unsigned iterations = 0;
+    
+    if (p == 0) {
+        longitude = 0.0; //undefined longitude
+        latitude = (z > 0) ? PI/2 : -PI/2; //at the poles
+        altitude = fabs(z) - WGS84::b; // h = z - b;
+    } else {      
+        if (x == 0) {
+            longitude = (y > 0) ? PI/2 : -PI/2;
+        } else {
+            longitude = atan2(y,x);
+        }
+
+        latitude = atan2(z,p); //initial guess for latitude
+        do {
+            lat = latitude;
+            N = WGS84::a / sqrt(1-WGS84::e2*pow(sin(latitude),2));
+            altitude = p / cos(latitude) - N;
+            latitude = atan(z / (p*(1-WGS84::e2*N / (N+altitude))));
+            iterations++;
+        } while (fabs(lat-latitude) > ECF::latTol);
+
+        //recompute altitude once latitude converges
+        N = WGS84::a / sqrt(1-WGS84::e2*pow(sin(latitude),2));
+        altitude = p / cos(latitude) - N;
+    }
+    
+    latitude = latitude*rad2deg;
+    longitude = longitude*rad2deg;
+    return iterations;
+}
+
+/***** local frame helpers ****************************************************/
+/*
+ * Fused conversions between ECF and the DCA axes of a shared frame, whose
+ * rotation rows are the DownRange, CrossRange and Above unit vectors in ECF,
+ * so multi-hop conversions need one translation and one rotation and no
+ * intermediate objects or trigonometry.
+ */
+static void ecfToDCA(double X, double Y, double Z, const frameData &frame,
+        double &downRange, double &crossRange, double &above){
+    const double (*R)[3] = frame.dcaRotation;
+    COORDINATESYSTEMS_COUNT(COUNTER_TO_LOCAL,1);
+
+    X -= frame.originECF[0];
+    Y -= frame.originECF[1];
+    Z -= frame.originECF[2];
+    downRange = R[0][0]*X + R[0][1]*Y + R[0][2]*Z;
+    crossRange = R[1][0]*X + R[1][1]*Y + R[1][2]*Z;
+    above = R[2][0]*X + R[2][1]*Y + R[2][2]*Z;
+}
+static void dcaToECF(double downRange, double crossRange, double above, const frameData &frame,
+        double &X, double &Y, double &Z){
+    const double (*R)[3] = frame.dcaRotation;
+    COORDINATESYSTEMS_COUNT(COUNTER_FROM_LOCAL,1);
+
+    X = frame.originECF[0] + R[0][0]*downRange + R[1][0]*crossRange + R[2][0]*above;
+    Y = frame.originECF[1] + R[0][1]*downRange + R[1][1]*crossRange + R[2][1]*above;
+    Z = frame.originECF[2] + R[0][2]*downRange + R[1][2]*crossRange + R[2][2]*above;
+}
+static frameHandle internFrame(LLA &origin, double heading){
+    return FrameCache::get(origin.getFirstCoordinate(),origin.getSecondCoordinate(),origin.getThirdCoordinate(),heading);
+}
 /***** positionVector *********************************************************/
 positionVector::positionVector(double first, double second, double third) {
     this->setPosition(first,second,third);
@@ -74,12 +193,16 @@ void positionVector::setThirdCoordinate(double third){
     z = third;
 }
 std::vector<double> positionVector::getPosition(){
-    std::vector<double> position;
-    
-    position.push_back(x);
-    position.push_back(y);
-    position.push_back(z);
-    
+    //one allocation, where three push_backs reallocate up to three times
+    return std::vector<double>{x, y, z};
+}
+void positionVector::getPosition(double position[3]){
+    position[0] = x;
+    position[1] = y;
+    position[2] = z;
+}
+std::array<double, 3> positionVector::getCoordinates(){
+    std::array<double, 3> position = {{x, y, z}};
     return position;
 }
 double positionVector::getFirstCoordinate(){
@@ -118,69 +241,77 @@ ECF::ECF(double X, double Y, double Z) : Cartesian(X,Y,Z), earthCentered(){
 ECF::~ECF() {
 }
 ENU ECF::toENU(LLA origin){
-    double east, north, up;
-    double dx, dy, dz;
-    double lat, lon;
-    
-    ECF originECF = origin.toECF();
-    dx = x-originECF.getFirstCoordinate();
-    dy = y-originECF.getSecondCoordinate();
-    dz = z-originECF.getThirdCoordinate();
-    lat = origin.getFirstCoordinate()*deg2rad;
-    lon = origin.getSecondCoordinate()*deg2rad;    
- 
-    east = -dx*sin(lon) + dy*cos(lon);
-    north = -dx*sin(lat)*cos(lon) - dy*sin(lat)*sin(lon) + dz*cos(lat);
-    up =  dx*cos(lat)*cos(lon) + dy*cos(lat)*sin(lon) + dz*sin(lat);
-    
-    return ENU(east,north,up,origin);
+    return this->toENU(origin.getFirstCoordinate(),origin.getSecondCoordinate(),origin.getThirdCoordinate());
 }
 ENU ECF::toENU(double latitude, double longitude, double altitude){
-    LLA latLonAlt(latitude,longitude,altitude);
-    return this->toENU(latLonAlt);
+    double east, north, up;
+    double dx, dy, dz;
+    frameHandle frame = FrameCache::get(latitude,longitude,altitude);
+    const double (*R)[3] = frame->enuRotation;
+
+    COORDINATESYSTEMS_COUNT(COUNTER_TO_LOCAL,1);
+    dx = x-frame->originECF[0];
+    dy = y-frame->originECF[1];
+    dz = z-frame->originECF[2];
+
+    east = R[0][0]*dx + R[0][1]*dy;
+    north = R[1][0]*dx + R[1][1]*dy + R[1][2]*dz;
+    up = R[2][0]*dx + R[2][1]*dy + R[2][2]*dz;
+
+    return ENU(east,north,up,frame);
 }
 DCA ECF::toDCA(LLA origin, double heading){
-    return this->toENU(origin).toDCA(heading);
+    return this->toDCA(origin.getFirstCoordinate(),origin.getSecondCoordinate(),origin.getThirdCoordinate(),heading);
 }
 DCA ECF::toDCA(double latitude, double longitude, double altitude, double heading){
-    return this->toENU(latitude,longitude,altitude).toDCA(heading);
+    double downRange, crossRange, above;
+    frameHandle frame = FrameCache::get(latitude,longitude,altitude,heading);
+    ecfToDCA(x,y,z,*frame,downRange,crossRange,above);
+    return DCA(downRange,crossRange,above,frame);
 }
 AER ECF::toAER(LLA origin, double heading){
-    return this->toDCA(origin,heading).toAER();
+    return this->toAER(origin.getFirstCoordinate(),origin.getSecondCoordinate(),origin.getThirdCoordinate(),heading);
 }
 AER ECF::toAER(double latitude, double longitude, double altitude, double heading){
-    return this->toDCA(latitude,longitude,altitude,heading).toAER();
+    double downRange, crossRange, above;
+    double azimuth, elevation, range;
+    frameHandle frame = FrameCache::get(latitude,longitude,altitude,heading);
+    ecfToDCA(x,y,z,*frame,downRange,crossRange,above);
+    DCA::toAER(downRange,crossRange,above,azimuth,elevation,range);
+    return AER(azimuth,elevation,range,frame);
 }
 LLA ECF::toLLA(){
-    double p = sqrt(pow(x,2)+pow(y,2));
-    double lat,N;
     double latitude, longitude, altitude;
-    
-    if (p == 0) {
-        longitude = 0.0; //undefined longitude
-        latitude = (z > 0) ? PI/2 : -PI/2; //at the poles
-        altitude = fabs(z) - sqrt(pow(a,2)*(1-e2)); // h = z - b;
-    } else {      
-        if (x == 0) {
-            longitude = (y > 0) ? PI/2 : -PI/2;
-        } else {
-            longitude = atan2(y,x);
-        }
-
-        latitude = atan2(z,p); //initial guess for latitude
-        do {
-            lat = latitude;
-            N = a / sqrt(1-e2*pow(sin(latitude),2));
-            altitude = p / cos(latitude) - N;
-            latitude = atan(z / (p*(1-e2*N / (N+altitude))));
-        } while (fabs(lat-latitude) > latTol);
-
-        //recompute altitude once latitude converges
-        N = a / sqrt(1-e2*pow(sin(latitude),2));
-        altitude = p / cos(latitude) - N;
+    ECF::toLLA(x,y,z,latitude,longitude,altitude);
+    return LLA(latitude,longitude,altitude);
+}
+void ECF::toLLA(double x, double y, double z, double &latitude, double &longitude, double &altitude){
+    ECF::toLLA(x,y,z,latitude,longitude,altitude,GEODETIC_ITERATIVE);
+}
+LLA ECF::toLLA(geodeticSolver solver, unsigned iterations){
+    double latitude, longitude, altitude;
+    ECF::toLLA(x,y,z,latitude,longitude,altitude,solver,iterations);
+    return LLA(latitude,longitude,altitude);
+}
+void ECF::toLLA(double x, double y, double z, double &latitude, double &longitude, double &altitude, geodeticSolver solver, unsigned iterations){
+    COORDINATESYSTEMS_TIME(TIMER_ECF_TO_LLA);
+    unsigned used = 0;
+    switch (solver) {
+        case GEODETIC_FIXED:
+            used = bowringToLLA(x,y,z,(iterations > 0) ? iterations : 1,0.0,latitude,longitude,altitude);
+            break;
+        case GEODETIC_MILLIMETRE:
+            used = bowringToLLA(x,y,z,maxIterations,millimetreTol,latitude,longitude,altitude);
+            break;
+        case GEODETIC_CLOSED_FORM:
+            kernels::ecfToLLAClosedForm(x,y,z,a,e2,latitude,longitude,altitude);
+            break;
+        default:
+            used = iterativeToLLA(x,y,z,latitude,longitude,altitude);
+            break;
     }
-    
-    return LLA(latitude*rad2deg,longitude*rad2deg,altitude);
+    COORDINATESYSTEMS_COUNT(COUNTER_ECF_TO_LLA,1);
+    COORDINATESYSTEMS_ITERATIONS(used,altitude);
 }
 /***** LLA ********************************************************************/
 LLA::LLA (double latitude, double longitude, double altitude) :
@@ -198,59 +329,80 @@ ENU LLA::toENU(double latitude, double longitude, double altitude){
     return this->toECF().toENU(latitude,longitude,altitude);
 }
 DCA LLA::toDCA(LLA origin, double heading){
-    return this->toECF().toDCA(origin,heading);
+    return this->toDCA(origin.getFirstCoordinate(),origin.getSecondCoordinate(),origin.getThirdCoordinate(),heading);
 }
 DCA LLA::toDCA(double latitude, double longitude, double altitude, double heading){
-    return this->toECF().toDCA(latitude,longitude,altitude,heading);
+    double X, Y, Z;
+    double downRange, crossRange, above;
+    frameHandle frame = FrameCache::get(latitude,longitude,altitude,heading);
+    LLA::toECF(x,y,z,X,Y,Z);
+    ecfToDCA(X,Y,Z,*frame,downRange,crossRange,above);
+    return DCA(downRange,crossRange,above,frame);
 }
 AER LLA::toAER(LLA origin, double heading){
-    return this->toDCA(origin,heading).toAER();
+    return this->toAER(origin.getFirstCoordinate(),origin.getSecondCoordinate(),origin.getThirdCoordinate(),heading);
 }
 AER LLA::toAER(double latitude, double longitude, double altitude, double heading){
-    return this->toDCA(latitude,longitude,altitude,heading).toAER();
+    double X, Y, Z;
+    double downRange, crossRange, above;
+    double azimuth, elevation, range;
+    frameHandle frame = FrameCache::get(latitude,longitude,altitude,heading);
+    LLA::toECF(x,y,z,X,Y,Z);
+    ecfToDCA(X,Y,Z,*frame,downRange,crossRange,above);
+    DCA::toAER(downRange,crossRange,above,azimuth,elevation,range);
+    return AER(azimuth,elevation,range,frame);
 }
 ECF LLA::toECF(){
     double X, Y, Z;
-    double N = a / sqrt(1-e2*pow(sin(x*deg2rad),2));
-    X = (N + z)*cos(x*deg2rad)*cos(y*deg2rad);
-    Y = (N + z)*cos(x*deg2rad)*sin(y*deg2rad);
-    Z = (N*(1-e2) + z)*sin(x*deg2rad);
+    LLA::toECF(x,y,z,X,Y,Z);
     return ECF(X,Y,Z);
 }
+void LLA::toECF(double latitude, double longitude, double altitude, double &X, double &Y, double &Z){
+    COORDINATESYSTEMS_COUNT(COUNTER_LLA_TO_ECF,1);
+    double sinLat = sin(latitude*deg2rad);
+    double cosLat = cos(latitude*deg2rad);
+    double N = a / sqrt(1-e2*sinLat*sinLat);
+    X = (N + altitude)*cosLat*cos(longitude*deg2rad);
+    Y = (N + altitude)*cosLat*sin(longitude*deg2rad);
+    Z = (N*WGS84::oneMinusE2 + altitude)*sinLat;
+}
 /***** earthFixed *************************************************************/
-earthFixed::earthFixed(){
-    origin = LLA();
-    originSet = false;
-    heading = 0.0;
+static const frameHandle &defaultFrame(){
+    static const frameHandle frame = FrameRegistry::internHeading(0.0);
+    return frame;
 }
-earthFixed::earthFixed(LLA latLonAlt, double h) {
-    origin = latLonAlt;
-    originSet = true;
-    heading = h;
+earthFixed::earthFixed() : frame(defaultFrame()) {
+}
+earthFixed::earthFixed(LLA latLonAlt, double h) : frame(internFrame(latLonAlt,h)) {
 }
 earthFixed::earthFixed(double latitude, double longitude, double altitude, double h) :
-origin(latitude,longitude,altitude){
-    originSet = true;
-    heading = h;
+frame(FrameCache::get(latitude,longitude,altitude,h)) {
+}
+earthFixed::earthFixed(frameHandle f) : frame(f) {
 }
 earthFixed::~earthFixed() {
 }
 void earthFixed::setOrigin(LLA latLonAlt){
-    origin = latLonAlt;
-    originSet = true;
+    frame = internFrame(latLonAlt,frame->heading);
 }
 void earthFixed::setOrigin(double latitude, double longitude, double altitude){
-    origin = LLA(latitude,longitude,altitude);
-    originSet = true;
+    frame = FrameCache::get(latitude,longitude,altitude,frame->heading);
 }
 LLA earthFixed::getOrigin(){
-    return origin;
+    return LLA(frame->latitude,frame->longitude,frame->altitude);
+}
+frameHandle earthFixed::getFrame(){
+    return frame;
 }
 void earthFixed::setHeading(double h){
-    heading = h;
+    if (frame->originSet) {
+        frame = FrameCache::get(frame->latitude,frame->longitude,frame->altitude,h);
+    } else {
+        frame = FrameCache::getHeading(h);
+    }
 }
 double earthFixed::getHeading(){
-    return heading;
+    return frame->heading;
 }
 /***** ENU ********************************************************************/
 ENU::ENU(double east, double north, double up) : Cartesian(east,north,up), earthFixed(){
@@ -262,44 +414,46 @@ ENU::ENU(double east, double north, double up, LLA origin) : Cartesian(east,nort
 ENU::ENU(double east, double north, double up, double latitude, double longitude, double altitude) :
 Cartesian(east,north,up), earthFixed(latitude,longitude,altitude){
 }
+ENU::ENU(double east, double north, double up, frameHandle f) : Cartesian(east,north,up), earthFixed(f){
+}
 ENU::~ENU(){
 }
 ECF ENU::toECF() throw (std::exception){
     double X, Y, Z;
-    double lat, lon;
+    const double (*R)[3] = frame->enuRotation;
     
-    if (!originSet){
+    if (!frame->originSet){
+        COORDINATESYSTEMS_COUNT(COUNTER_ORIGIN_NOT_SET,1);
         throw std::runtime_error("Cannot convert to ECF, origin not set.");
     }
     
-    ECF originECF = origin.toECF();
-    lat = origin.getFirstCoordinate()*deg2rad;
-    lon = origin.getSecondCoordinate()*deg2rad;
-    
-    X = -x*sin(lon) - y*sin(lat)*cos(lon) + z*cos(lat)*cos(lon) + originECF.getFirstCoordinate();
-    Y =  x*cos(lon) - y*sin(lat)*sin(lon) + z*cos(lat)*sin(lon) + originECF.getSecondCoordinate();
-    Z =  y*cos(lat) + z*sin(lat) + originECF.getThirdCoordinate();
+    COORDINATESYSTEMS_COUNT(COUNTER_FROM_LOCAL,1);
+    X = R[0][0]*x + R[1][0]*y + R[2][0]*z + frame->originECF[0];
+    Y = R[0][1]*x + R[1][1]*y + R[2][1]*z + frame->originECF[1];
+    Z = R[1][2]*y + R[2][2]*z + frame->originECF[2];
     
     return ECF(X,Y,Z);
 }
 LLA ENU::toLLA() throw (std::exception){
-    if (!originSet){
+    if (!frame->originSet){
+        COORDINATESYSTEMS_COUNT(COUNTER_ORIGIN_NOT_SET,1);
         throw std::runtime_error("Cannot convert to ECF, origin not set.");
     }
     return this->toECF().toLLA();
 }
 DCA ENU::toDCA(double h){
     double downRange, crossRange, above;
-    downRange = x*sin(h*deg2rad) + y*cos(h*deg2rad);;
-    crossRange = -x*cos(h*deg2rad) + y*sin(h*deg2rad);;
+    double sinHeading = sin(h*deg2rad);
+    double cosHeading = cos(h*deg2rad);
+    downRange = x*sinHeading + y*cosHeading;
+    crossRange = -x*cosHeading + y*sinHeading;
     above = z;
 
-    DCA result(downRange,crossRange,above);
-    result.setHeading(h);
-    if (originSet){
-        result.setOrigin(origin);
+    if (frame->originSet){
+        return DCA(downRange,crossRange,above,FrameCache::get(frame->latitude,frame->longitude,frame->altitude,h));
+    } else {
+        return DCA(downRange,crossRange,above,h);
     }
-    return result;
 }
 AER ENU::toAER(double h) {
     return this->toDCA(h).toAER();
@@ -307,7 +461,9 @@ AER ENU::toAER(double h) {
 /***** DCA ********************************************************************/
 DCA::DCA(double downRange, double crossRange, double above, double h) :
 Cartesian(downRange,crossRange,above), earthFixed(){
-    heading = h;
+    if (h != 0.0) {
+        this->setHeading(h);
+    }
 }
 DCA::DCA(LLA origin, double h) : Cartesian(), earthFixed(origin,h){
 }
@@ -317,36 +473,53 @@ Cartesian(downRange,crossRange,above), earthFixed(origin,h){
 DCA::DCA(double downRange, double crossRange, double above, double latitude, double longitude, double altitude, double h) :
 Cartesian(downRange,crossRange,above), earthFixed(latitude,longitude,altitude,h){
 }
+DCA::DCA(double downRange, double crossRange, double above, frameHandle f) :
+Cartesian(downRange,crossRange,above), earthFixed(f){
+}
 DCA::~DCA() {
 }
 ECF DCA::toECF() throw (std::exception){
-    if (!originSet){
+    double X, Y, Z;
+    if (!frame->originSet){
+        COORDINATESYSTEMS_COUNT(COUNTER_ORIGIN_NOT_SET,1);
         throw std::runtime_error("Cannot convert to ECF, origin not set.");
     }
-    return this->toENU().toECF();
+    dcaToECF(x,y,z,*frame,X,Y,Z);
+    return ECF(X,Y,Z);
 }
 LLA DCA::toLLA() throw (std::exception){
-    if (!originSet){
+    double X, Y, Z;
+    double latitude, longitude, altitude;
+    if (!frame->originSet){
+        COORDINATESYSTEMS_COUNT(COUNTER_ORIGIN_NOT_SET,1);
         throw std::runtime_error("Cannot convert to ECF, origin not set.");
     }
-    return this->toECF().toLLA();
+    dcaToECF(x,y,z,*frame,X,Y,Z);
+    ECF::toLLA(X,Y,Z,latitude,longitude,altitude);
+    return LLA(latitude,longitude,altitude);
 }
 ENU DCA::toENU(){
     double east, north, up;
-    east = x*sin(heading*deg2rad) - y*cos(heading*deg2rad);
-    north = x*cos(heading*deg2rad) + y*sin(heading*deg2rad);
+    double sinHeading = sin(frame->heading*deg2rad);
+    double cosHeading = cos(frame->heading*deg2rad);
+    east = x*sinHeading - y*cosHeading;
+    north = x*cosHeading + y*sinHeading;
     up = z;
-    if (originSet){
-        return ENU(east,north,up,origin);
+    if (frame->originSet){
+        return ENU(east,north,up,FrameCache::get(frame->latitude,frame->longitude,frame->altitude));
     } else {
         return ENU(east,north,up);
     }
 }
 AER DCA::toAER(){
     double azimuth, elevation, range;
+    DCA::toAER(x,y,z,azimuth,elevation,range);
+    return AER(azimuth,elevation,range,frame);
+}
+void DCA::toAER(double x, double y, double z, double &azimuth, double &elevation, double &range){
     double p = sqrt(pow(x,2)+pow(y,2));
     
-    range = this->getMagnitude();
+    range = sqrt(pow(x,2)+pow(y,2)+pow(z,2));
     if (range == 0) {
         azimuth = 0.0; //undefined azimuth
         elevation = 0.0; //undefined elevation
@@ -357,16 +530,15 @@ AER DCA::toAER(){
         azimuth = atan2(-y,x);
         elevation = atan2(z,p);
     }
-    if (originSet){
-        return AER(azimuth*rad2deg,elevation*rad2deg,range,origin,heading);
-    } else {
-        return AER(azimuth*rad2deg,elevation*rad2deg,range,heading);
-    }
+    azimuth = azimuth*rad2deg;
+    elevation = elevation*rad2deg;
 }
 /***** AER ********************************************************************/
 AER::AER(double azimuth, double elevation, double range, double h) : 
 Spherical(azimuth,elevation,range), earthFixed() {
-    heading = h;
+    if (h != 0.0) {
+        this->setHeading(h);
+    }
 }
 AER::AER(LLA origin, double h) : Spherical(), earthFixed(origin,h){
 }
@@ -376,31 +548,45 @@ Spherical(azimuth,elevation,range), earthFixed(origin,h){
 AER::AER(double azimuth, double elevation, double range, double latitude, double longitude, double altitude, double h) :
 Spherical(azimuth,elevation,range), earthFixed(latitude,longitude,altitude,h){
 }
+AER::AER(double azimuth, double elevation, double range, frameHandle f) :
+Spherical(azimuth,elevation,range), earthFixed(f){
+}
 AER::~AER() {
 }
 ECF AER::toECF() throw (std::exception){
-    if (!originSet){
+    double X, Y, Z;
+    double downRange, crossRange, above;
+    if (!frame->originSet){
+        COORDINATESYSTEMS_COUNT(COUNTER_ORIGIN_NOT_SET,1);
         throw std::runtime_error("Cannot convert to ECF, origin not set.");
     }
-    return this->toENU().toECF();
+    AER::toDCA(x,y,z,downRange,crossRange,above);
+    dcaToECF(downRange,crossRange,above,*frame,X,Y,Z);
+    return ECF(X,Y,Z);
 }
 LLA AER::toLLA() throw (std::exception){
-    if (!originSet){
+    double X, Y, Z;
+    double downRange, crossRange, above;
+    double latitude, longitude, altitude;
+    if (!frame->originSet){
+        COORDINATESYSTEMS_COUNT(COUNTER_ORIGIN_NOT_SET,1);
         throw std::runtime_error("Cannot convert to ECF, origin not set.");
     }
-    return this->toECF().toLLA();
+    AER::toDCA(x,y,z,downRange,crossRange,above);
+    dcaToECF(downRange,crossRange,above,*frame,X,Y,Z);
+    ECF::toLLA(X,Y,Z,latitude,longitude,altitude);
+    return LLA(latitude,longitude,altitude);
 }
 ENU AER::toENU(){
     return this->toDCA().toENU();
 }
 DCA AER::toDCA(){
     double downRange, crossRange, above;
+    AER::toDCA(x,y,z,downRange,crossRange,above);
+    return DCA(downRange,crossRange,above,frame);
+}
+void AER::toDCA(double x, double y, double z, double &downRange, double &crossRange, double &above){
     downRange = z*cos(x*deg2rad)*cos(y*deg2rad);
     crossRange = -z*sin(x*deg2rad)*cos(y*deg2rad);
     above = z*sin(y*deg2rad);
-    if (originSet){
-        return DCA(downRange,crossRange,above,origin,heading);
-    } else {
-        return DCA(downRange,crossRange,above,heading);
-    }
 }
@@ -0,0 +1,228 @@
+/**
+ * @brief Covariance transformation implementation.
+ * @file covarianceTransforms.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Analytic Jacobians and batched 3x3 covariance transforms between
+ * the ECF, ENU, DCA and AER frames of a LocalFrame.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include <math.h>
+#include "covarianceTransforms.h"
+#include "instrumentation.h"
+
+using namespace coordinateSystems;
+
+/***** helpers ****************************************************************/
+static const double degreesPerRadian = rad2deg;
+static const double radiansPerDegree = deg2rad;
+
+/*
+ * out = J*P*J^T for one row-major covariance. The input is read before the
+ * output is written, so the two may be the same matrix.
+ */
+static void transform(const double J[3][3], const double *in, double *out){
+    double T[3][3];
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            T[i][j] = J[i][0]*in[j] + J[i][1]*in[3+j] + J[i][2]*in[6+j];
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            out[3*i+j] = T[i][0]*J[j][0] + T[i][1]*J[j][1] + T[i][2]*J[j][2];
+        }
+    }
+}
+static void transpose(const double R[3][3], double T[3][3]){
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            T[i][j] = R[j][i];
+        }
+    }
+}
+static void multiply(const double A[3][3], const double B[3][3], double C[3][3]){
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            C[i][j] = A[i][0]*B[0][j] + A[i][1]*B[1][j] + A[i][2]*B[2][j];
+        }
+    }
+}
+static void linear(size_t count, const double J[3][3], const double *in, double *out){
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    for (size_t i = 0; i < count; i++) {
+        transform(J,in + 9*i,out + 9*i);
+    }
+}
+
+/***** Jacobians **************************************************************/
+void coordinateSystems::dcaToAERJacobian(double downRange, double crossRange, double above, double J[3][3]){
+    double p2 = downRange*downRange + crossRange*crossRange;
+    double r2 = p2 + above*above;
+    double p = sqrt(p2), r = sqrt(r2);
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            J[i][j] = 0.0;
+        }
+    }
+    if (r == 0) {
+        return; //undefined azimuth, elevation and range direction
+    }
+    J[2][0] = downRange/r;
+    J[2][1] = crossRange/r;
+    J[2][2] = above/r;
+    if (p == 0) {
+        return; //undefined azimuth, vertical elevation
+    }
+    //azimuth = atan2(-crossRange, downRange), elevation = atan2(above, p)
+    J[0][0] = crossRange/p2*degreesPerRadian;
+    J[0][1] = -downRange/p2*degreesPerRadian;
+    J[1][0] = -above*downRange/(r2*p)*degreesPerRadian;
+    J[1][1] = -above*crossRange/(r2*p)*degreesPerRadian;
+    J[1][2] = p/r2*degreesPerRadian;
+}
+void coordinateSystems::aerToDCAJacobian(double azimuth, double elevation, double range, double J[3][3]){
+    double sinAz = sin(azimuth*radiansPerDegree), cosAz = cos(azimuth*radiansPerDegree);
+    double sinEl = sin(elevation*radiansPerDegree), cosEl = cos(elevation*radiansPerDegree);
+    double k = range*radiansPerDegree;
+
+    //downRange = r cos(el) cos(az), crossRange = -r cos(el) sin(az), above = r sin(el)
+    J[0][0] = -k*cosEl*sinAz;
+    J[0][1] = -k*sinEl*cosAz;
+    J[0][2] = cosEl*cosAz;
+    J[1][0] = -k*cosEl*cosAz;
+    J[1][1] = k*sinEl*sinAz;
+    J[1][2] = -cosEl*sinAz;
+    J[2][0] = 0.0;
+    J[2][1] = k*cosEl;
+    J[2][2] = sinEl;
+}
+void coordinateSystems::ecfToAERJacobian(ECFVec ecf, LocalFrame &frame, double J[3][3]){
+    double R[3][3], polar[3][3];
+    DCAVec dca = frame.toDCA(ecf);
+    frame.getDCARotation(R);
+    dcaToAERJacobian(dca.first,dca.second,dca.third,polar);
+    multiply(polar,R,J);
+}
+
+/***** rotations **************************************************************/
+void coordinateSystems::ecfToENUCovariance(size_t count, const double *in, double *out, LocalFrame &frame){
+    double R[3][3];
+    frame.getRotation(R);
+    linear(count,R,in,out);
+}
+void coordinateSystems::enuToECFCovariance(size_t count, const double *in, double *out, LocalFrame &frame){
+    double R[3][3], T[3][3];
+    frame.getRotation(R);
+    transpose(R,T);
+    linear(count,T,in,out);
+}
+void coordinateSystems::enuToDCACovariance(size_t count, const double *in, double *out, LocalFrame &frame){
+    double H[3][3];
+    frame.getHeadingRotation(H);
+    linear(count,H,in,out);
+}
+void coordinateSystems::dcaToENUCovariance(size_t count, const double *in, double *out, LocalFrame &frame){
+    double H[3][3], T[3][3];
+    frame.getHeadingRotation(H);
+    transpose(H,T);
+    linear(count,T,in,out);
+}
+void coordinateSystems::ecfToDCACovariance(size_t count, const double *in, double *out, LocalFrame &frame){
+    double R[3][3];
+    frame.getDCARotation(R);
+    linear(count,R,in,out);
+}
+void coordinateSystems::dcaToECFCovariance(size_t count, const double *in, double *out, LocalFrame &frame){
+    double R[3][3], T[3][3];
+    frame.getDCARotation(R);
+    transpose(R,T);
+    linear(count,T,in,out);
+}
+
+/***** polar ******************************************************************/
+void coordinateSystems::dcaToAERCovariance(size_t count, constCoordinateArray positions, const double *in, double *out){
+    double J[3][3];
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    for (size_t i = 0; i < count; i++) {
+        size_t k = i*positions.stride;
+        dcaToAERJacobian(positions.first[k],positions.second[k],positions.third[k],J);
+        transform(J,in + 9*i,out + 9*i);
+    }
+}
+void coordinateSystems::aerToDCACovariance(size_t count, constCoordinateArray positions, const double *in, double *out){
+    double J[3][3];
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    for (size_t i = 0; i < count; i++) {
+        size_t k = i*positions.stride;
+        aerToDCAJacobian(positions.first[k],positions.second[k],positions.third[k],J);
+        transform(J,in + 9*i,out + 9*i);
+    }
+}
+void coordinateSystems::ecfToAERCovariance(size_t count, constCoordinateArray positions, const double *in, double *out,
+        LocalFrame &frame){
+    double R[3][3], polar[3][3], J[3][3];
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    frame.getDCARotation(R);
+    for (size_t i = 0; i < count; i++) {
+        size_t k = i*positions.stride;
+        DCAVec dca = frame.toDCA(ECFVec(positions.first[k],positions.second[k],positions.third[k]));
+        dcaToAERJacobian(dca.first,dca.second,dca.third,polar);
+        multiply(polar,R,J);
+        transform(J,in + 9*i,out + 9*i);
+    }
+}
+void coordinateSystems::aerToECFCovariance(size_t count, constCoordinateArray positions, const double *in, double *out,
+        LocalFrame &frame){
+    double R[3][3], T[3][3], polar[3][3], J[3][3];
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    frame.getDCARotation(R);
+    transpose(R,T);
+    for (size_t i = 0; i < count; i++) {
+        size_t k = i*positions.stride;
+        aerToDCAJacobian(positions.first[k],positions.second[k],positions.third[k],polar);
+        multiply(T,polar,J);
+        transform(J,in + 9*i,out + 9*i);
+    }
+}
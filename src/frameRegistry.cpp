@@ -0,0 +1,334 @@
+/**
+ * @brief Shared Earth-fixed frame registry implementation.
+ * @file frameRegistry.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Interns the origins and headings of Earth-fixed points so that
+ * every ENU, DCA and AER point of a frame references one shared, precomputed
+ * copy of the frame instead of holding its own, with a per-thread cache in
+ * front of the registry for the conversions given raw origin coordinates.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "coordinateSystems.h"
+#include "frameRegistry.h"
+
+using namespace coordinateSystems;
+
+/***** registry storage *******************************************************/
+/*
+ * Frames are keyed on the bit patterns of their origin and heading, so two
+ * points share a frame only if they would convert identically.
+ */
+namespace {
+struct frameKey {
+    uint64_t bits[4];
+    bool originSet;
+    bool operator==(const frameKey &other) const {
+        return originSet == other.originSet && memcmp(bits,other.bits,sizeof(bits)) == 0;
+    }
+};
+//64-bit finalizer of MurmurHash3; the low bits of round numbers are zero
+inline uint64_t mix(uint64_t h){
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+struct frameKeyHash {
+    size_t operator()(const frameKey &key) const {
+        uint64_t h = key.originSet ? 1 : 0;
+        for (int i = 0; i < 4; i++) {
+            h = mix(h ^ key.bits[i]);
+        }
+        return (size_t) h;
+    }
+};
+typedef std::unordered_map<frameKey, std::weak_ptr<const frameData>, frameKeyHash> frameMap;
+
+const size_t minimumSweep = 64;
+
+struct registryStorage {
+    std::mutex lock;
+    frameMap frames;
+    size_t sweepSize;
+    registryStorage() : sweepSize(minimumSweep) {
+    }
+};
+registryStorage &storage(){
+    static registryStorage registry;
+    return registry;
+}
+
+frameKey makeKey(double latitude, double longitude, double altitude, double heading, bool originSet){
+    frameKey key;
+    double values[4] = {latitude, longitude, altitude, heading};
+    memcpy(key.bits,values,sizeof(values));
+    key.originSet = originSet;
+    return key;
+}
+
+/*
+ * Same trigonometry as the per-point conversions used before frames were
+ * shared, so results do not depend on whether a frame was interned.
+ */
+std::shared_ptr<frameData> buildFrame(double latitude, double longitude, double altitude, double heading, bool originSet){
+    std::shared_ptr<frameData> frame = std::make_shared<frameData>();
+    double lat = latitude*deg2rad;
+    double lon = longitude*deg2rad;
+    double sinLat = sin(lat), cosLat = cos(lat);
+    double sinLon = sin(lon), cosLon = cos(lon);
+    double sinHeading = sin(heading*deg2rad), cosHeading = cos(heading*deg2rad);
+
+    frame->latitude = latitude;
+    frame->longitude = longitude;
+    frame->altitude = altitude;
+    frame->heading = heading;
+    frame->originSet = originSet;
+    LLA::toECF(latitude,longitude,altitude,frame->originECF[0],frame->originECF[1],frame->originECF[2]);
+
+    frame->enuRotation[0][0] = -sinLon;
+    frame->enuRotation[0][1] = cosLon;
+    frame->enuRotation[0][2] = 0.0;
+    frame->enuRotation[1][0] = -sinLat*cosLon;
+    frame->enuRotation[1][1] = -sinLat*sinLon;
+    frame->enuRotation[1][2] = cosLat;
+    frame->enuRotation[2][0] = cosLat*cosLon;
+    frame->enuRotation[2][1] = cosLat*sinLon;
+    frame->enuRotation[2][2] = sinLat;
+
+    for (int i = 0; i < 3; i++) {
+        frame->dcaRotation[0][i] = frame->enuRotation[0][i]*sinHeading + frame->enuRotation[1][i]*cosHeading;
+        frame->dcaRotation[1][i] = -frame->enuRotation[0][i]*cosHeading + frame->enuRotation[1][i]*sinHeading;
+        frame->dcaRotation[2][i] = frame->enuRotation[2][i];
+    }
+    return frame;
+}
+
+frameHandle lookup(const frameKey &key, double latitude, double longitude, double altitude, double heading, bool originSet){
+    registryStorage &registry = storage();
+    std::lock_guard<std::mutex> guard(registry.lock);
+
+    frameMap::iterator entry = registry.frames.find(key);
+    if (entry != registry.frames.end()) {
+        frameHandle frame = entry->second.lock();
+        if (frame) {
+            return frame;
+        }
+    }
+
+    //drop the frames nobody references once the map has doubled
+    if (registry.frames.size() >= registry.sweepSize) {
+        for (frameMap::iterator it = registry.frames.begin(); it != registry.frames.end();) {
+            if (it->second.expired()) {
+                it = registry.frames.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        registry.sweepSize = 2*registry.frames.size() > minimumSweep ? 2*registry.frames.size() : minimumSweep;
+    }
+
+    frameHandle frame = buildFrame(latitude,longitude,altitude,heading,originSet);
+    registry.frames[key] = frame;
+    return frame;
+}
+
+/***** per-thread caches ******************************************************/
+/*
+ * Only the owning thread touches the slots of a cache. The hit and miss
+ * counts are written by the owner with a relaxed load and store and read by
+ * other threads with relaxed loads, as in the instrumentation; caches are
+ * registered in a list on first use and their counts folded into a retired
+ * total when their thread exits.
+ */
+const unsigned cacheWays = 4;
+const unsigned cacheSets = FrameCache::slotCount/cacheWays;
+
+struct cacheSlot {
+    frameKey key;
+    frameHandle frame;
+    uint64_t used; //clock of the last hit, 0 if empty
+};
+struct threadCache {
+    cacheSlot slots[cacheSets][cacheWays];
+    uint64_t clock;
+    std::atomic<uint64_t> hits, misses;
+    threadCache() : clock(0) {
+        for (unsigned i = 0; i < cacheSets; i++) {
+            for (unsigned j = 0; j < cacheWays; j++) {
+                slots[i][j].used = 0;
+            }
+        }
+        hits.store(0,std::memory_order_relaxed);
+        misses.store(0,std::memory_order_relaxed);
+    }
+};
+
+struct cacheStorage {
+    std::mutex lock;
+    std::vector<threadCache*> caches;
+    uint64_t retiredHits, retiredMisses;
+    cacheStorage() : retiredHits(0), retiredMisses(0) {
+    }
+};
+cacheStorage &caches(){
+    static cacheStorage instance;
+    return instance;
+}
+
+struct cacheHandle {
+    threadCache cache;
+    cacheHandle(){
+        cacheStorage &c = caches();
+        std::lock_guard<std::mutex> guard(c.lock);
+        c.caches.push_back(&cache);
+    }
+    ~cacheHandle(){
+        cacheStorage &c = caches();
+        std::lock_guard<std::mutex> guard(c.lock);
+        c.retiredHits += cache.hits.load(std::memory_order_relaxed);
+        c.retiredMisses += cache.misses.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < c.caches.size(); i++) {
+            if (c.caches[i] == &cache) {
+                c.caches[i] = c.caches.back();
+                c.caches.pop_back();
+                break;
+            }
+        }
+    }
+};
+
+threadCache &localCache(){
+    static thread_local cacheHandle handle;
+    return handle.cache;
+}
+
+void bump(std::atomic<uint64_t> &count){
+    count.store(count.load(std::memory_order_relaxed) + 1,std::memory_order_relaxed);
+}
+
+//looks the key up in its set and replaces the least recently used way on a miss
+frameHandle cached(double latitude, double longitude, double altitude, double heading, bool originSet){
+    threadCache &cache = localCache();
+    frameKey key = makeKey(latitude,longitude,altitude,heading,originSet);
+    cacheSlot *set = cache.slots[frameKeyHash()(key) % cacheSets];
+    cacheSlot *victim = set;
+
+    cache.clock++;
+    for (unsigned i = 0; i < cacheWays; i++) {
+        if (set[i].used != 0 && set[i].key == key) {
+            set[i].used = cache.clock;
+            bump(cache.hits);
+            return set[i].frame;
+        }
+        if (set[i].used < victim->used) {
+            victim = set + i;
+        }
+    }
+    bump(cache.misses);
+    victim->frame = lookup(key,latitude,longitude,altitude,heading,originSet);
+    victim->key = key;
+    victim->used = cache.clock;
+    return victim->frame;
+}
+}
+
+/***** FrameRegistry **********************************************************/
+frameHandle FrameRegistry::intern(double latitude, double longitude, double altitude, double heading){
+    return lookup(makeKey(latitude,longitude,altitude,heading,true),latitude,longitude,altitude,heading,true);
+}
+frameHandle FrameRegistry::internHeading(double heading){
+    return lookup(makeKey(0.0,0.0,0.0,heading,false),0.0,0.0,0.0,heading,false);
+}
+size_t FrameRegistry::size(){
+    registryStorage &registry = storage();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    size_t count = 0;
+    for (frameMap::const_iterator it = registry.frames.begin(); it != registry.frames.end(); ++it) {
+        if (!it->second.expired()) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/***** FrameCache *************************************************************/
+frameHandle FrameCache::get(double latitude, double longitude, double altitude, double heading){
+    return cached(latitude,longitude,altitude,heading,true);
+}
+frameHandle FrameCache::getHeading(double heading){
+    return cached(0.0,0.0,0.0,heading,false);
+}
+FrameCache::statistics FrameCache::getStatistics(){
+    cacheStorage &c = caches();
+    std::lock_guard<std::mutex> guard(c.lock);
+    statistics result = {c.retiredHits, c.retiredMisses};
+    for (size_t i = 0; i < c.caches.size(); i++) {
+        result.hits += c.caches[i]->hits.load(std::memory_order_relaxed);
+        result.misses += c.caches[i]->misses.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+void FrameCache::resetStatistics(){
+    cacheStorage &c = caches();
+    std::lock_guard<std::mutex> guard(c.lock);
+    c.retiredHits = 0;
+    c.retiredMisses = 0;
+    for (size_t i = 0; i < c.caches.size(); i++) {
+        c.caches[i]->hits.store(0,std::memory_order_relaxed);
+        c.caches[i]->misses.store(0,std::memory_order_relaxed);
+    }
+}
+void FrameCache::clear(){
+    threadCache &cache = localCache();
+    for (unsigned i = 0; i < cacheSets; i++) {
+        for (unsigned j = 0; j < cacheWays; j++) {
+            cache.slots[i][j].frame.reset();
+            cache.slots[i][j].used = 0;
+        }
+    }
+}
@@ -0,0 +1,354 @@
+/**
+ * @brief Geodetic batch kernels.
+ * @file geodeticKernels.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Conversion operations built from the formulas in
+ * conversionKernels.h, and the block driver that feeds strided coordinate
+ * arrays through a pack kernel. Internal to the library.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef GEODETICKERNELS_H
+#define	GEODETICKERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+#include "coordinateSystems.h"
+#include "ellipsoid.h"
+#include "simdMath.h"
+#include "kernels.h"
+
+namespace coordinateSystems {
+namespace kernels {
+//internal linkage: kernelsSSE2.cpp, kernelsAVX2.cpp and kernelsAVX512.cpp
+//compile these for different instruction sets, so no copy may be shared
+//with another translation unit
+namespace {
+
+/**
+ * @brief Fused conversion from ECF or LLA to the axes of a local frame, in
+ * Cartesian or AER form, for convertBlocks.
+ *
+ * One translation and one rotation whatever the path; no intermediate
+ * arrays.
+ */
+template <bool fromLLA, bool toAER>
+struct toLocalOperation {
+    const frameConstants *frame;
+    double padding(int) const { return 0.0; }
+    template <class T>
+    void operator()(T _first, T _second, T _third, T &_out0, T &_out1, T &_out2) const {
+        T x = _first, y = _second, z = _third;
+        if (fromLLA) {
+            llaToECFSinCos(_first,_second,_third,frame->a,frame->e2,x,y,z);
+        }
+        T l0, l1, l2;
+        rotateToLocal(x,y,z,frame->origin,frame->rotation,l0,l1,l2);
+        if (toAER) {
+            dcaToAERPolar(l0,l1,l2,_out0,_out1,_out2);
+        } else {
+            _out0 = l0;
+            _out1 = l1;
+            _out2 = l2;
+        }
+    }
+};
+
+/**
+ * @brief Fused conversion from the axes of a local frame, in Cartesian or AER
+ * form, to ECF or LLA, for convertBlocks.
+ */
+template <bool fromAER, bool toLLA>
+struct fromLocalOperation {
+    const frameConstants *frame;
+    double padding(int) const { return 0.0; }
+    template <class T>
+    void operator()(T _first, T _second, T _third, T &_out0, T &_out1, T &_out2) const {
+        T l0 = _first, l1 = _second, l2 = _third;
+        if (fromAER) {
+            aerToDCAPolar(_first,_second,_third,l0,l1,l2);
+        }
+        T x, y, z;
+        rotateFromLocal(l0,l1,l2,frame->origin,frame->rotation,x,y,z);
+        if (toLLA) {
+            ecfToLLAClosedForm(x,y,z,frame->a,frame->e2,_out0,_out1,_out2);
+        } else {
+            _out0 = x;
+            _out1 = y;
+            _out2 = z;
+        }
+    }
+};
+
+/**
+ * @brief ecfToLLAClosedForm bound to an ellipsoid, for convertBlocks.
+ */
+struct ecfToLLAOperation {
+    double a, e2;
+    double padding(int _axis) const { return (_axis == 0) ? a : 0.0; }
+    template <class T>
+    void operator()(T _x, T _y, T _z, T &_latitude, T &_longitude, T &_altitude) const {
+        ecfToLLAClosedForm(_x,_y,_z,a,e2,_latitude,_longitude,_altitude);
+    }
+};
+
+/**
+ * @brief ecfToLLASpherical bound to a sphere radius, for convertBlocks.
+ */
+struct ecfToLLASphericalOperation {
+    double a;
+    double padding(int _axis) const { return (_axis == 0) ? a : 0.0; }
+    template <class T>
+    void operator()(T _x, T _y, T _z, T &_latitude, T &_longitude, T &_altitude) const {
+        ecfToLLASpherical(_x,_y,_z,a,_latitude,_longitude,_altitude);
+    }
+};
+
+/**
+ * @brief llaToECFSinCos bound to an ellipsoid, for convertBlocks.
+ */
+struct llaToECFOperation {
+    double a, e2;
+    double padding(int) const { return 0.0; }
+    template <class T>
+    void operator()(T _latitude, T _longitude, T _altitude, T &_x, T &_y, T &_z) const {
+        llaToECFSinCos(_latitude,_longitude,_altitude,a,e2,_x,_y,_z);
+    }
+};
+
+/**
+ * @brief llaToECFSpherical bound to a sphere radius, for convertBlocks.
+ */
+struct llaToECFSphericalOperation {
+    double a;
+    double padding(int) const { return 0.0; }
+    template <class T>
+    void operator()(T _latitude, T _longitude, T _altitude, T &_x, T &_y, T &_z) const {
+        llaToECFSpherical(_latitude,_longitude,_altitude,a,_x,_y,_z);
+    }
+};
+
+/**
+ * @brief Runs a point-wise operation over strided arrays, one pack at a time.
+ *
+ * Contiguous full packs are loaded directly; strided or partial packs are
+ * gathered through a small buffer, with unused lanes padded by the
+ * operation's padding point so they stay finite. Each pack is loaded before
+ * it is stored, so the output may alias the input.
+ */
+template <class P, class Operation>
+void convertBlocks(size_t count, const double *first, const double *second, const double *third, size_t inStride,
+        double *outFirst, double *outSecond, double *outThird, size_t outStride, const Operation &operation){
+    const size_t W = P::width;
+    double b0[P::width], b1[P::width], b2[P::width];
+    size_t i, l, n;
+    P in0, in1, in2, out0, out1, out2;
+
+    for (i = 0; i < count; i += W) {
+        n = (count-i < W) ? count-i : W;
+        if (inStride == 1 && n == W) {
+            in0 = P::load(first+i);
+            in1 = P::load(second+i);
+            in2 = P::load(third+i);
+        } else {
+            for (l = 0; l < W; l++) {
+                b0[l] = (l < n) ? first[(i+l)*inStride] : operation.padding(0);
+                b1[l] = (l < n) ? second[(i+l)*inStride] : operation.padding(1);
+                b2[l] = (l < n) ? third[(i+l)*inStride] : operation.padding(2);
+            }
+            in0 = P::load(b0);
+            in1 = P::load(b1);
+            in2 = P::load(b2);
+        }
+
+        operation(in0,in1,in2,out0,out1,out2);
+
+        if (outStride == 1 && n == W) {
+            out0.store(outFirst+i);
+            out1.store(outSecond+i);
+            out2.store(outThird+i);
+        } else {
+            out0.store(b0);
+            out1.store(b1);
+            out2.store(b2);
+            for (l = 0; l < n; l++) {
+                outFirst[(i+l)*outStride] = b0[l];
+                outSecond[(i+l)*outStride] = b1[l];
+                outThird[(i+l)*outStride] = b2[l];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Runs a point-wise operation over strided arrays with pack type P, or
+ * one point at a time when P is double.
+ */
+template <class P>
+struct blockConverter {
+    template <class Operation>
+    static void run(size_t count, const double *first, const double *second, const double *third, size_t inStride,
+            double *outFirst, double *outSecond, double *outThird, size_t outStride, const Operation &operation){
+        convertBlocks<P>(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,operation);
+    }
+};
+template <>
+struct blockConverter<double> {
+    template <class Operation>
+    static void run(size_t count, const double *first, const double *second, const double *third, size_t inStride,
+            double *outFirst, double *outSecond, double *outThird, size_t outStride, const Operation &operation){
+        size_t i, j, k;
+        for (i = 0, j = 0, k = 0; i < count; i++, j += inStride, k += outStride) {
+            operation(first[j],second[j],third[j],outFirst[k],outSecond[k],outThird[k]);
+        }
+    }
+};
+
+/**
+ * @brief Lane bit of a scalar comparison, counterpart of the pack laneBits
+ * overloads.
+ */
+inline unsigned laneBits(bool _mask){
+    return _mask ? 1u : 0u;
+}
+
+/**
+ * @brief Visibility test of one point or one pack of ECF points from the DCA
+ * axes of a sensor, with dot products only.
+ * @param x, y, z: ECF coordinates in meters.
+ * @param frame: DCA frame constants of the sensor.
+ * @param limits: Squared maximum range and sines of the mask elevations.
+ * @param high: Receives the lane bits of the points within range and at or
+ * above the highest mask elevation, origin excluded.
+ * @param low: Receives the lane bits of the points within range and at or
+ * above the lowest mask elevation.
+ *
+ * The elevation is at least E exactly when above >= range*sin(E), which needs
+ * one square root and no arctangent.
+ */
+template <class T>
+inline void visibilityTest(T x, T y, T z, const frameConstants &frame, const visibilityConstants &limits,
+        unsigned &high, unsigned &low){
+    using ::sqrt;
+    T downRange, crossRange, above;
+
+    rotateToLocal(x,y,z,frame.origin,frame.rotation,downRange,crossRange,above);
+    T range2 = downRange*downRange + crossRange*crossRange + above*above;
+    T range = sqrt(range2);
+    auto inRange = (range2 <= T(limits.range2));
+    low = laneBits(inRange & (above >= range*T(limits.sinLow)));
+    high = laneBits(inRange & (above >= range*T(limits.sinHigh)) & (range2 > T(0.0)));
+}
+
+/**
+ * @brief Runs visibilityTest over strided arrays one pack at a time and packs
+ * the lane bits into 64-bit words (see visibilityKernel).
+ *
+ * Each word covers 64 points. Strided or partial words are first copied into
+ * contiguous buffers, padded with the origin whose lanes are then discarded,
+ * so the packs are always loaded from contiguous memory.
+ */
+template <class P>
+void visibilityBlocks(size_t count, const double *x, const double *y, const double *z, size_t stride,
+        const frameConstants &frame, const visibilityConstants &limits, uint64_t *clear, uint64_t *ambiguous){
+    const size_t W = P::width;
+    double b0[64], b1[64], b2[64];
+    const double *p0, *p1, *p2;
+    size_t word, begin, i, n;
+    unsigned high, low;
+
+    for (word = 0, begin = 0; begin < count; word++, begin += 64) {
+        uint64_t clearBits = 0, ambiguousBits = 0;
+        n = (count - begin < 64) ? count - begin : 64;
+        if (stride == 1 && n == 64) {
+            p0 = x + begin;
+            p1 = y + begin;
+            p2 = z + begin;
+        } else {
+            for (i = 0; i < n; i++) {
+                b0[i] = x[(begin+i)*stride];
+                b1[i] = y[(begin+i)*stride];
+                b2[i] = z[(begin+i)*stride];
+            }
+            for (; i % W != 0; i++) {
+                b0[i] = frame.origin[0];
+                b1[i] = frame.origin[1];
+                b2[i] = frame.origin[2];
+            }
+            p0 = b0;
+            p1 = b1;
+            p2 = b2;
+        }
+        for (i = 0; i < n; i += W) {
+            visibilityTest(P::load(p0+i),P::load(p1+i),P::load(p2+i),frame,limits,high,low);
+            uint64_t lanes = (n - i < W) ? ((uint64_t) 1 << (n - i)) - 1 : ((uint64_t) 1 << W) - 1;
+            clearBits |= ((uint64_t) high & lanes) << i;
+            ambiguousBits |= ((uint64_t) (low & ~high) & lanes) << i;
+        }
+        clear[word] = clearBits;
+        ambiguous[word] = ambiguousBits;
+    }
+}
+
+/**
+ * @brief Runs toLocalOperation or fromLocalOperation over strided arrays with
+ * the selectors resolved at compile time.
+ */
+template <class P, template <bool, bool> class Operation>
+void convertFrame(size_t count, const double *first, const double *second, const double *third, size_t inStride,
+        double *outFirst, double *outSecond, double *outThird, size_t outStride, const frameConstants &frame,
+        bool select0, bool select1){
+    if (select0 && select1) {
+        Operation<true,true> operation = {&frame};
+        blockConverter<P>::run(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,operation);
+    } else if (select0) {
+        Operation<true,false> operation = {&frame};
+        blockConverter<P>::run(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,operation);
+    } else if (select1) {
+        Operation<false,true> operation = {&frame};
+        blockConverter<P>::run(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,operation);
+    } else {
+        Operation<false,false> operation = {&frame};
+        blockConverter<P>::run(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,operation);
+    }
+}
+}
+}
+}
+#endif	/* GEODETICKERNELS_H */
@@ -0,0 +1,141 @@
+/**
+ * @brief Warm-started ECF to LLA conversion class implementation.
+ * @file geodeticTrack.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Bowring's iteration seeded from the latitudes of the previous
+ * points of a track, carried as sine/cosine pairs so that the seed costs no
+ * trigonometry.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include <math.h>
+#include "geodeticTrack.h"
+#include "conversionKernels.h"
+
+using namespace coordinateSystems;
+
+/***** GeodeticTrack **********************************************************/
+GeodeticTrack::GeodeticTrack() : history(0), iterations(0){
+}
+GeodeticTrack::~GeodeticTrack(){
+}
+void GeodeticTrack::reset(){
+    history = 0;
+}
+unsigned GeodeticTrack::getIterations(){
+    return iterations;
+}
+LLA GeodeticTrack::toLLA(ECF ecf){
+    double latitude, longitude, altitude;
+    this->toLLA(ecf.getFirstCoordinate(),ecf.getSecondCoordinate(),ecf.getThirdCoordinate(),latitude,longitude,altitude);
+    return LLA(latitude,longitude,altitude);
+}
+void GeodeticTrack::toLLA(double x, double y, double z, double &latitude, double &longitude, double &altitude){
+    const double ratio = WGS84::ratio;
+    const double b = WGS84::b;
+    const double ep2 = WGS84::ep2;
+    const double aE2 = WGS84::aE2;
+    double p = sqrt(x*x+y*y);
+    double sinLat, cosLat, sinBeta, cosBeta, norm;
+    double num = z, den = p;
+    bool seeded = (history > 0);
+
+    if (history == 2) {
+        //latitude + (latitude - previous latitude), by the angle addition formulas
+        double sinStep = sinLatitude[0]*cosLatitude[1] - cosLatitude[0]*sinLatitude[1];
+        double cosStep = cosLatitude[0]*cosLatitude[1] + sinLatitude[0]*sinLatitude[1];
+        sinLat = sinLatitude[0]*cosStep + cosLatitude[0]*sinStep;
+        cosLat = cosLatitude[0]*cosStep - sinLatitude[0]*sinStep;
+    } else if (history == 1) {
+        sinLat = sinLatitude[0];
+        cosLat = cosLatitude[0];
+    } else {
+        sinLat = 0.0;
+        cosLat = 1.0;
+    }
+
+    for (iterations = 0; iterations < earthCentered::maxIterations; ) {
+        bool geodeticSeed = seeded; //the step only bounds the error from a geodetic latitude
+        if (seeded) {
+            //reduced latitude of the seed: tan(beta) = (b/a) tan(latitude)
+            norm = sqrt(ratio*sinLat*ratio*sinLat + cosLat*cosLat);
+            sinBeta = ratio*sinLat/norm;
+            cosBeta = cosLat/norm;
+        } else {
+            //usual seed: reduced latitude of the point itself
+            norm = sqrt(z*z + p*ratio*p*ratio);
+            sinBeta = (norm > 0) ? z/norm : 0.0;
+            cosBeta = (norm > 0) ? p*ratio/norm : 1.0;
+            sinLat = sinBeta;
+            cosLat = cosBeta;
+            seeded = true;
+        }
+        double previousSin = sinLat, previousCos = cosLat;
+        num = z + ep2*b*sinBeta*sinBeta*sinBeta;
+        den = p - aE2*cosBeta*cosBeta*cosBeta;
+        norm = sqrt(num*num + den*den);
+        sinLat = num/norm;
+        cosLat = den/norm;
+        iterations++;
+        double step = fabs(sinLat*previousCos - cosLat*previousSin);
+        if (geodeticSeed && step < trackTol) {
+            break;
+        }
+        if (iterations == 1 && history > 0 && step > restartTol) {
+            seeded = false; //far from the track, start over from the usual seed
+        }
+    }
+
+    altitude = p*cosLat + z*sinLat - WGS84::a*sqrt(1-WGS84::e2*sinLat*sinLat);
+    latitude = atan2(num,den)*kernels::degPerRad;
+    longitude = atan2(y,x)*kernels::degPerRad;
+
+    sinLatitude[1] = sinLatitude[0];
+    cosLatitude[1] = cosLatitude[0];
+    sinLatitude[0] = sinLat;
+    cosLatitude[0] = cosLat;
+    if (history < 2) {
+        history++;
+    }
+}
+void GeodeticTrack::toLLA(size_t count, constCoordinateArray in, coordinateArray out){
+    for (size_t i = 0; i < count; i++) {
+        this->toLLA(in.first[i*in.stride],in.second[i*in.stride],in.third[i*in.stride],
+                out.first[i*out.stride],out.second[i*out.stride],out.third[i*out.stride]);
+    }
+}
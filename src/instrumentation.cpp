@@ -0,0 +1,194 @@
+/**
+ * @brief Optional hot-path instrumentation implementation.
+ * @file instrumentation.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Each thread records into its own block of counters, which only that
+ * thread writes, so recording takes no lock and no atomic read-modify-write.
+ * Blocks are registered in a list under a mutex on first use and folded into a
+ * retired total when their thread exits; snapshots and resets walk the list
+ * under the same mutex.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "instrumentation.h"
+
+using namespace coordinateSystems;
+using namespace coordinateSystems::instrumentation;
+
+/***** per-thread blocks ******************************************************/
+namespace {
+
+const unsigned valueCount = COUNTER_COUNT + altitudeBands*iterationBins + TIMER_COUNT*latencyBins;
+
+/*
+ * Counters of one thread, laid out in the order of the snapshot fields.
+ * Only the owning thread writes, with a relaxed load and store rather than
+ * an atomic increment; other threads read with relaxed loads.
+ */
+struct threadBlock {
+    std::atomic<uint64_t> values[valueCount];
+    threadBlock(){
+        for (unsigned i = 0; i < valueCount; i++) {
+            values[i].store(0,std::memory_order_relaxed);
+        }
+    }
+    void add(unsigned index, uint64_t events){
+        values[index].store(values[index].load(std::memory_order_relaxed) + events,std::memory_order_relaxed);
+    }
+};
+
+//blocks of the running threads and the totals of the exited ones
+struct registry {
+    std::mutex mutex;
+    std::vector<threadBlock*> blocks;
+    uint64_t retired[valueCount];
+    registry(){
+        memset(retired,0,sizeof(retired));
+    }
+};
+
+registry &getRegistry(){
+    static registry instance;
+    return instance;
+}
+
+//registers the block of a thread on first use and retires it at thread exit
+struct threadHandle {
+    threadBlock block;
+    threadHandle(){
+        registry &r = getRegistry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.blocks.push_back(&block);
+    }
+    ~threadHandle(){
+        registry &r = getRegistry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (unsigned i = 0; i < valueCount; i++) {
+            r.retired[i] += block.values[i].load(std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < r.blocks.size(); i++) {
+            if (r.blocks[i] == &block) {
+                r.blocks[i] = r.blocks.back();
+                r.blocks.pop_back();
+                break;
+            }
+        }
+    }
+};
+
+threadBlock &localBlock(){
+    static thread_local threadHandle handle;
+    return handle.block;
+}
+
+}
+
+/***** instrumentation ********************************************************/
+bool instrumentation::enabled(){
+#ifdef COORDINATESYSTEMS_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+snapshot instrumentation::getSnapshot(){
+    uint64_t values[valueCount];
+    snapshot result;
+    registry &r = getRegistry();
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        memcpy(values,r.retired,sizeof(values));
+        for (size_t b = 0; b < r.blocks.size(); b++) {
+            for (unsigned i = 0; i < valueCount; i++) {
+                values[i] += r.blocks[b]->values[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    memcpy(result.counters,values,sizeof(result.counters));
+    memcpy(result.iterations,values + COUNTER_COUNT,sizeof(result.iterations));
+    memcpy(result.latency,values + COUNTER_COUNT + altitudeBands*iterationBins,sizeof(result.latency));
+    return result;
+}
+void instrumentation::reset(){
+    registry &r = getRegistry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    memset(r.retired,0,sizeof(r.retired));
+    for (size_t b = 0; b < r.blocks.size(); b++) {
+        for (unsigned i = 0; i < valueCount; i++) {
+            r.blocks[b]->values[i].store(0,std::memory_order_relaxed);
+        }
+    }
+}
+const char *instrumentation::counterName(counter c){
+    static const char *names[COUNTER_COUNT] = {"ecf_to_lla", "lla_to_ecf", "to_local", "from_local",
+        "batch_calls", "batch_points", "origin_not_set"};
+    return (c < COUNTER_COUNT) ? names[c] : "unknown";
+}
+const char *instrumentation::timerName(timer t){
+    static const char *names[TIMER_COUNT] = {"ecf_to_lla", "batch_call"};
+    return (t < TIMER_COUNT) ? names[t] : "unknown";
+}
+double instrumentation::altitudeBandLimit(unsigned band){
+    static const double limits[altitudeBands] = {0.0, 1.0e4, 1.0e5, 1.0e6, 1.0e7, HUGE_VAL};
+    return (band < altitudeBands) ? limits[band] : HUGE_VAL;
+}
+void instrumentation::count(counter c, uint64_t events){
+    localBlock().add(c,events);
+}
+void instrumentation::recordIterations(unsigned iterations, double altitude){
+    unsigned band = 0;
+    while (band + 1 < altitudeBands && !(altitude < altitudeBandLimit(band))) {
+        band++;
+    }
+    if (iterations >= iterationBins) {
+        iterations = iterationBins - 1;
+    }
+    localBlock().add(COUNTER_COUNT + band*iterationBins + iterations,1);
+}
+void instrumentation::recordLatency(timer t, uint64_t nanoseconds){
+    unsigned bin = 0;
+    while (bin + 1 < latencyBins && (nanoseconds >> (bin + 1)) != 0) {
+        bin++;
+    }
+    localBlock().add(COUNTER_COUNT + altitudeBands*iterationBins + t*latencyBins + bin,1);
+}
@@ -0,0 +1,138 @@
+/**
+ * @brief Batch kernel entry points.
+ * @file kernels.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Declarations of the per instruction set batch kernels. Each kernel
+ * lives in its own translation unit compiled for that instruction set;
+ * batchConversions.cpp picks one at run time. Internal to the library.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef KERNELS_H
+#define	KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COORDINATESYSTEMS_X86_KERNELS //build the SSE2, AVX2 and AVX-512 kernels
+#endif
+
+namespace coordinateSystems {
+namespace kernels {
+
+/*
+ * Geodetic kernels over strided arrays. Arguments: point count, the three
+ * input arrays and their stride, the three output arrays and their stride,
+ * ellipsoid semi-major axis and eccentricity squared.
+ */
+typedef void (*geodeticKernel)(size_t, const double*, const double*, const double*, size_t,
+        double*, double*, double*, size_t, double, double);
+
+//closed-form ECF to LLA, see ecfToLLAClosedForm in geodeticKernels.h
+void ecfToLLAScalar(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, double, double);
+//LLA to ECF with a shared sincos, see llaToECFSinCos in geodeticKernels.h
+void llaToECFScalar(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, double, double);
+
+/**
+ * @brief Constants of a local frame for the fused kernels.
+ *
+ * The rotation takes ECF offsets from the origin to the local axes (ENU, DCA
+ * or, with a zero origin, a heading rotation between ENU and DCA); its rows
+ * are the local unit vectors.
+ */
+struct frameConstants {
+    double origin[3];
+    double rotation[3][3];
+    double a, e2;
+};
+
+/*
+ * Fused frame kernels over strided arrays. Arguments: point count, the three
+ * input arrays and their stride, the three output arrays and their stride,
+ * the frame constants and the two selectors. toLocal converts ECF (or LLA if
+ * the first selector is set) to the rotated local axes (converted to AER if
+ * the second selector is set); fromLocal is the inverse, taking AER input if
+ * the first selector is set and producing LLA if the second is set.
+ */
+typedef void (*frameKernel)(size_t, const double*, const double*, const double*, size_t,
+        double*, double*, double*, size_t, const frameConstants&, bool, bool);
+
+void toLocalScalar(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, const frameConstants&, bool, bool);
+void fromLocalScalar(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, const frameConstants&, bool, bool);
+
+/**
+ * @brief Limits of the visibility kernels.
+ */
+struct visibilityConstants {
+    double range2; //squared maximum range
+    double sinLow, sinHigh; //sines of the lowest and highest mask elevations
+};
+
+/*
+ * Visibility kernels over strided ECF arrays. Arguments: point count, the
+ * three input arrays and their stride, the DCA frame constants of the sensor,
+ * the limits and two bit arrays of (count+63)/64 words. Bit i%64 of word i/64
+ * of the first array is set if point i is within range and above the highest
+ * mask elevation; of the second if it is within range and above the lowest
+ * but not the highest (or is the origin), so its azimuth decides.
+ */
+typedef void (*visibilityKernel)(size_t, const double*, const double*, const double*, size_t,
+        const frameConstants&, const visibilityConstants&, uint64_t*, uint64_t*);
+
+void visibilityScalar(size_t, const double*, const double*, const double*, size_t, const frameConstants&, const visibilityConstants&, uint64_t*, uint64_t*);
+#ifdef COORDINATESYSTEMS_X86_KERNELS
+void ecfToLLASSE2(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, double, double);
+void ecfToLLAAVX2(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, double, double);
+void ecfToLLAAVX512(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, double, double);
+void llaToECFSSE2(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, double, double);
+void llaToECFAVX2(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, double, double);
+void llaToECFAVX512(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, double, double);
+void toLocalSSE2(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, const frameConstants&, bool, bool);
+void toLocalAVX2(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, const frameConstants&, bool, bool);
+void toLocalAVX512(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, const frameConstants&, bool, bool);
+void fromLocalSSE2(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, const frameConstants&, bool, bool);
+void fromLocalAVX2(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, const frameConstants&, bool, bool);
+void fromLocalAVX512(size_t, const double*, const double*, const double*, size_t, double*, double*, double*, size_t, const frameConstants&, bool, bool);
+void visibilitySSE2(size_t, const double*, const double*, const double*, size_t, const frameConstants&, const visibilityConstants&, uint64_t*, uint64_t*);
+void visibilityAVX2(size_t, const double*, const double*, const double*, size_t, const frameConstants&, const visibilityConstants&, uint64_t*, uint64_t*);
+void visibilityAVX512(size_t, const double*, const double*, const double*, size_t, const frameConstants&, const visibilityConstants&, uint64_t*, uint64_t*);
+#endif
+}
+}
+#endif	/* KERNELS_H */
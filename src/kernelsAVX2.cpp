@@ -0,0 +1,106 @@
+/**
+ * @brief AVX2 and FMA batch kernels.
+ * @file kernelsAVX2.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Instantiates the batch kernel templates for packs of doubles in
+ * AVX2 and FMA registers. The whole translation unit is compiled for AVX2 and
+ * FMA; the caller must check processor support first.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include "kernels.h"
+
+#ifdef COORDINATESYSTEMS_X86_KERNELS
+//system headers must precede the target pragma
+#include <stddef.h>
+#include <math.h>
+#include <immintrin.h>
+#include "coordinateSystems.h"
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+#pragma GCC target("avx2,fma")
+#endif
+
+#include "packAVX2.h"
+#include "geodeticKernels.h"
+
+using namespace coordinateSystems;
+
+void kernels::ecfToLLAAVX2(size_t count, const double *x, const double *y, const double *z, size_t inStride,
+        double *latitude, double *longitude, double *altitude, size_t outStride, double a, double e2){
+    if (e2 == 0.0) {
+        ecfToLLASphericalOperation operation = {a};
+        convertBlocks<packAVX2>(count,x,y,z,inStride,latitude,longitude,altitude,outStride,operation);
+    } else {
+        ecfToLLAOperation operation = {a, e2};
+        convertBlocks<packAVX2>(count,x,y,z,inStride,latitude,longitude,altitude,outStride,operation);
+    }
+}
+void kernels::llaToECFAVX2(size_t count, const double *latitude, const double *longitude, const double *altitude,
+        size_t inStride, double *x, double *y, double *z, size_t outStride, double a, double e2){
+    if (e2 == 0.0) {
+        llaToECFSphericalOperation operation = {a};
+        convertBlocks<packAVX2>(count,latitude,longitude,altitude,inStride,x,y,z,outStride,operation);
+    } else {
+        llaToECFOperation operation = {a, e2};
+        convertBlocks<packAVX2>(count,latitude,longitude,altitude,inStride,x,y,z,outStride,operation);
+    }
+}
+void kernels::toLocalAVX2(size_t count, const double *first, const double *second, const double *third, size_t inStride,
+        double *outFirst, double *outSecond, double *outThird, size_t outStride, const frameConstants &frame,
+        bool fromLLA, bool toAER){
+    convertFrame<packAVX2,toLocalOperation>(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,
+            frame,fromLLA,toAER);
+}
+void kernels::fromLocalAVX2(size_t count, const double *first, const double *second, const double *third, size_t inStride,
+        double *outFirst, double *outSecond, double *outThird, size_t outStride, const frameConstants &frame,
+        bool fromAER, bool toLLA){
+    convertFrame<packAVX2,fromLocalOperation>(count,first,second,third,inStride,outFirst,outSecond,outThird,outStride,
+            frame,fromAER,toLLA);
+}
+void kernels::visibilityAVX2(size_t count, const double *x, const double *y, const double *z, size_t stride,
+        const frameConstants &frame, const visibilityConstants &limits, uint64_t *clear, uint64_t *ambiguous){
+    visibilityBlocks<packAVX2>(count,x,y,z,stride,frame,limits,clear,ambiguous);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @brief Local frame class implementation.
+ * @file localFrame.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Reusable Earth-fixed local frame (origin and heading) that caches
+ * the origin ECF position, the ECF to East-North-Up (ENU) rotation and the
+ * heading rotation so that repeated conversions against a fixed site do not
+ * recompute the origin trigonometry.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include <math.h>
+#include "localFrame.h"
+
+using namespace coordinateSystems;
+
+/***** LocalFrame *************************************************************/
+LocalFrame::LocalFrame(LLA latLonAlt, double h) : origin(latLonAlt), heading(h){
+    this->initialize();
+}
+LocalFrame::LocalFrame(double latitude, double longitude, double altitude, double h) :
+origin(latitude,longitude,altitude), heading(h){
+    this->initialize();
+}
+LocalFrame::~LocalFrame(){
+}
+void LocalFrame::initialize(){
+    enuFrame = FrameRegistry::intern(origin.getFirstCoordinate(),origin.getSecondCoordinate(),origin.getThirdCoordinate());
+    originX = enuFrame->originECF[0];
+    originY = enuFrame->originECF[1];
+    originZ = enuFrame->originECF[2];
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            rotation[i][j] = enuFrame->enuRotation[i][j];
+        }
+    }
+
+    this->setHeading(heading);
+}
+LLA LocalFrame::getOrigin(){
+    return origin;
+}
+ECF LocalFrame::getOriginECF(){
+    return ECF(originX,originY,originZ);
+}
+void LocalFrame::getRotation(double R[3][3]){
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            R[i][j] = rotation[i][j];
+        }
+    }
+}
+void LocalFrame::getDCARotation(double R[3][3]){
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            R[i][j] = dcaRotation[i][j];
+        }
+    }
+}
+void LocalFrame::getHeadingRotation(double R[3][3]){
+    R[0][0] = sinHeading;
+    R[0][1] = cosHeading;
+    R[0][2] = 0.0;
+    R[1][0] = -cosHeading;
+    R[1][1] = sinHeading;
+    R[1][2] = 0.0;
+    R[2][0] = 0.0;
+    R[2][1] = 0.0;
+    R[2][2] = 1.0;
+}
+void LocalFrame::setHeading(double h){
+    heading = h;
+    sinHeading = sin(h*deg2rad);
+    cosHeading = cos(h*deg2rad);
+    dcaFrame = FrameRegistry::intern(enuFrame->latitude,enuFrame->longitude,enuFrame->altitude,h);
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            dcaRotation[i][j] = dcaFrame->dcaRotation[i][j];
+        }
+    }
+}
+double LocalFrame::getHeading(){
+    return heading;
+}
+ENU LocalFrame::toENU(double X, double Y, double Z){
+    ENUVec enu = this->toENU(ECFVec(X,Y,Z));
+    return ENU(enu.first,enu.second,enu.third,enuFrame);
+}
+DCA LocalFrame::toDCA(double X, double Y, double Z){
+    DCAVec dca = this->toDCA(ECFVec(X,Y,Z));
+    return DCA(dca.first,dca.second,dca.third,dcaFrame);
+}
+AER LocalFrame::toAER(double X, double Y, double Z){
+    AERVec aer = this->toAER(ECFVec(X,Y,Z));
+    return AER(aer.first,aer.second,aer.third,dcaFrame);
+}
+ENU LocalFrame::toENU(ECF ecf){
+    return this->toENU(ecf.getFirstCoordinate(),ecf.getSecondCoordinate(),ecf.getThirdCoordinate());
+}
+DCA LocalFrame::toDCA(ECF ecf){
+    return this->toDCA(ecf.getFirstCoordinate(),ecf.getSecondCoordinate(),ecf.getThirdCoordinate());
+}
+AER LocalFrame::toAER(ECF ecf){
+    return this->toAER(ecf.getFirstCoordinate(),ecf.getSecondCoordinate(),ecf.getThirdCoordinate());
+}
+ENU LocalFrame::toENU(LLA lla){
+    return this->toENU(lla.toECF());
+}
+DCA LocalFrame::toDCA(LLA lla){
+    return this->toDCA(lla.toECF());
+}
+AER LocalFrame::toAER(LLA lla){
+    return this->toAER(lla.toECF());
+}
+DCA LocalFrame::toDCA(ENU enu){
+    DCAVec dca = this->toDCA(toVec3(enu));
+    return DCA(dca.first,dca.second,dca.third,dcaFrame);
+}
+AER LocalFrame::toAER(ENU enu){
+    AERVec aer = this->toAER(toVec3(enu));
+    return AER(aer.first,aer.second,aer.third,dcaFrame);
+}
+ENU LocalFrame::toENU(DCA dca){
+    ENUVec enu = this->toENU(toVec3(dca));
+    return ENU(enu.first,enu.second,enu.third,enuFrame);
+}
+ENU LocalFrame::toENU(AER aer){
+    ENUVec enu = this->toENU(toVec3(aer));
+    return ENU(enu.first,enu.second,enu.third,enuFrame);
+}
+ECF LocalFrame::toECF(ENU enu){
+    return toClass(this->toECF(toVec3(enu)));
+}
+ECF LocalFrame::toECF(DCA dca){
+    return toClass(this->toECF(toVec3(dca)));
+}
+ECF LocalFrame::toECF(AER aer){
+    return toClass(this->toECF(toVec3(aer)));
+}
+LLA LocalFrame::toLLA(ENU enu){
+    return this->toECF(enu).toLLA();
+}
+LLA LocalFrame::toLLA(DCA dca){
+    return this->toECF(dca).toLLA();
+}
+LLA LocalFrame::toLLA(AER aer){
+    return this->toECF(aer).toLLA();
+}
@@ -0,0 +1,113 @@
+/**
+ * @brief AVX2 double precision pack.
+ * @file packAVX2.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Four-lane pack and mask types with the arithmetic, comparison,
+ * select, lane bit and math overloads used by the batch kernels. Include only
+ * from a translation unit compiled for AVX2 and FMA, after all system
+ * headers. Internal to the library.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef PACKAVX2_H
+#define	PACKAVX2_H
+
+#include <immintrin.h>
+#include "simdMath.h"
+
+namespace coordinateSystems {
+namespace kernels {
+//internal linkage, like geodeticKernels.h, so that templates instantiated
+//with this pack are never shared with another translation unit
+namespace {
+
+/**
+ * @brief Lane mask produced by packAVX2 comparisons.
+ */
+class maskAVX2 {
+public:
+    maskAVX2(__m256d _v) : v(_v) {}
+    __m256d v;
+};
+
+/**
+ * @brief Four doubles held in an AVX register.
+ */
+class packAVX2 {
+public:
+    typedef maskAVX2 mask;
+    static const int width = 4;
+    packAVX2() {}
+    packAVX2(__m256d _v) : v(_v) {}
+    packAVX2(double _s) : v(_mm256_set1_pd(_s)) {}
+    static packAVX2 load(const double *_p) { return packAVX2(_mm256_loadu_pd(_p)); }
+    void store(double *_p) const { _mm256_storeu_pd(_p,v); }
+    __m256d v;
+};
+
+inline packAVX2 operator+(packAVX2 a, packAVX2 b) { return _mm256_add_pd(a.v,b.v); }
+inline packAVX2 operator-(packAVX2 a, packAVX2 b) { return _mm256_sub_pd(a.v,b.v); }
+inline packAVX2 operator*(packAVX2 a, packAVX2 b) { return _mm256_mul_pd(a.v,b.v); }
+inline packAVX2 operator/(packAVX2 a, packAVX2 b) { return _mm256_div_pd(a.v,b.v); }
+inline packAVX2 operator-(packAVX2 a) { return _mm256_xor_pd(a.v,_mm256_set1_pd(-0.0)); }
+inline maskAVX2 operator<(packAVX2 a, packAVX2 b) { return _mm256_cmp_pd(a.v,b.v,_CMP_LT_OQ); }
+inline maskAVX2 operator>(packAVX2 a, packAVX2 b) { return _mm256_cmp_pd(a.v,b.v,_CMP_GT_OQ); }
+inline maskAVX2 operator<=(packAVX2 a, packAVX2 b) { return _mm256_cmp_pd(a.v,b.v,_CMP_LE_OQ); }
+inline maskAVX2 operator>=(packAVX2 a, packAVX2 b) { return _mm256_cmp_pd(a.v,b.v,_CMP_GE_OQ); }
+inline maskAVX2 operator==(packAVX2 a, packAVX2 b) { return _mm256_cmp_pd(a.v,b.v,_CMP_EQ_OQ); }
+inline maskAVX2 operator&(maskAVX2 a, maskAVX2 b) { return _mm256_and_pd(a.v,b.v); }
+inline maskAVX2 operator|(maskAVX2 a, maskAVX2 b) { return _mm256_or_pd(a.v,b.v); }
+inline unsigned laneBits(maskAVX2 m) { return (unsigned) _mm256_movemask_pd(m.v); }
+inline packAVX2 select(maskAVX2 m, packAVX2 a, packAVX2 b) { return _mm256_blendv_pd(b.v,a.v,m.v); }
+inline packAVX2 sqrt(packAVX2 a) { return _mm256_sqrt_pd(a.v); }
+inline packAVX2 fabs(packAVX2 a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0),a.v); }
+inline packAVX2 fmin(packAVX2 a, packAVX2 b) { return _mm256_min_pd(a.v,b.v); }
+inline packAVX2 fmax(packAVX2 a, packAVX2 b) { return _mm256_max_pd(a.v,b.v); }
+inline packAVX2 cbrtEstimate(packAVX2 a) {
+    //single precision bit trick: divide the exponent by three
+    __m128i bits = _mm_castps_si128(_mm256_cvtpd_ps(a.v));
+    bits = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(bits),_mm_set1_ps(1.0f/3.0f)));
+    bits = _mm_add_epi32(bits,_mm_set1_epi32(709958130));
+    return _mm256_cvtps_pd(_mm_castsi128_ps(bits));
+}
+inline packAVX2 atan2(packAVX2 y, packAVX2 x) { return atan2Generic(y,x); }
+inline packAVX2 cbrt(packAVX2 a) { return cbrtGeneric(a); }
+}
+}
+}
+#endif	/* PACKAVX2_H */
@@ -0,0 +1,113 @@
+/**
+ * @brief AVX-512 double precision pack.
+ * @file packAVX512.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Eight-lane pack and mask types with the arithmetic, comparison,
+ * select, lane bit and math overloads used by the batch kernels. Include only
+ * from a translation unit compiled for AVX-512F, AVX2 and FMA, after all
+ * system headers. Internal to the library.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef PACKAVX512_H
+#define	PACKAVX512_H
+
+#include <immintrin.h>
+#include "simdMath.h"
+
+namespace coordinateSystems {
+namespace kernels {
+//internal linkage, like geodeticKernels.h, so that templates instantiated
+//with this pack are never shared with another translation unit
+namespace {
+
+/**
+ * @brief Lane mask produced by packAVX512 comparisons.
+ */
+class maskAVX512 {
+public:
+    maskAVX512(__mmask8 _v) : v(_v) {}
+    __mmask8 v;
+};
+
+/**
+ * @brief Eight doubles held in an AVX-512 register.
+ */
+class packAVX512 {
+public:
+    typedef maskAVX512 mask;
+    static const int width = 8;
+    packAVX512() {}
+    packAVX512(__m512d _v) : v(_v) {}
+    packAVX512(double _s) : v(_mm512_set1_pd(_s)) {}
+    static packAVX512 load(const double *_p) { return packAVX512(_mm512_loadu_pd(_p)); }
+    void store(double *_p) const { _mm512_storeu_pd(_p,v); }
+    __m512d v;
+};
+
+inline packAVX512 operator+(packAVX512 a, packAVX512 b) { return _mm512_add_pd(a.v,b.v); }
+inline packAVX512 operator-(packAVX512 a, packAVX512 b) { return _mm512_sub_pd(a.v,b.v); }
+inline packAVX512 operator*(packAVX512 a, packAVX512 b) { return _mm512_mul_pd(a.v,b.v); }
+inline packAVX512 operator/(packAVX512 a, packAVX512 b) { return _mm512_div_pd(a.v,b.v); }
+inline packAVX512 operator-(packAVX512 a) { return _mm512_sub_pd(_mm512_setzero_pd(),a.v); }
+inline maskAVX512 operator<(packAVX512 a, packAVX512 b) { return _mm512_cmp_pd_mask(a.v,b.v,_CMP_LT_OQ); }
+inline maskAVX512 operator>(packAVX512 a, packAVX512 b) { return _mm512_cmp_pd_mask(a.v,b.v,_CMP_GT_OQ); }
+inline maskAVX512 operator<=(packAVX512 a, packAVX512 b) { return _mm512_cmp_pd_mask(a.v,b.v,_CMP_LE_OQ); }
+inline maskAVX512 operator>=(packAVX512 a, packAVX512 b) { return _mm512_cmp_pd_mask(a.v,b.v,_CMP_GE_OQ); }
+inline maskAVX512 operator==(packAVX512 a, packAVX512 b) { return _mm512_cmp_pd_mask(a.v,b.v,_CMP_EQ_OQ); }
+inline maskAVX512 operator&(maskAVX512 a, maskAVX512 b) { return (__mmask8)(a.v & b.v); }
+inline maskAVX512 operator|(maskAVX512 a, maskAVX512 b) { return (__mmask8)(a.v | b.v); }
+inline unsigned laneBits(maskAVX512 m) { return (unsigned) m.v; }
+inline packAVX512 select(maskAVX512 m, packAVX512 a, packAVX512 b) { return _mm512_mask_blend_pd(m.v,b.v,a.v); }
+inline packAVX512 sqrt(packAVX512 a) { return _mm512_sqrt_pd(a.v); }
+inline packAVX512 fabs(packAVX512 a) { return _mm512_abs_pd(a.v); }
+inline packAVX512 fmin(packAVX512 a, packAVX512 b) { return _mm512_min_pd(a.v,b.v); }
+inline packAVX512 fmax(packAVX512 a, packAVX512 b) { return _mm512_max_pd(a.v,b.v); }
+inline packAVX512 cbrtEstimate(packAVX512 a) {
+    //single precision bit trick: divide the exponent by three
+    __m256i bits = _mm256_castps_si256(_mm512_cvtpd_ps(a.v));
+    bits = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(bits),_mm256_set1_ps(1.0f/3.0f)));
+    bits = _mm256_add_epi32(bits,_mm256_set1_epi32(709958130));
+    return _mm512_cvtps_pd(_mm256_castsi256_ps(bits));
+}
+inline packAVX512 atan2(packAVX512 y, packAVX512 x) { return atan2Generic(y,x); }
+inline packAVX512 cbrt(packAVX512 a) { return cbrtGeneric(a); }
+}
+}
+}
+#endif	/* PACKAVX512_H */
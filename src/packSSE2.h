@@ -0,0 +1,115 @@
+/**
+ * @brief SSE2 double precision pack.
+ * @file packSSE2.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Two-lane pack and mask types with the arithmetic, comparison,
+ * select, lane bit and math overloads used by the batch kernels. Include only
+ * from a translation unit that may use SSE2 instructions, after all system
+ * headers. Internal to the library.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef PACKSSE2_H
+#define	PACKSSE2_H
+
+#include <emmintrin.h>
+#include "simdMath.h"
+
+namespace coordinateSystems {
+namespace kernels {
+//internal linkage, like geodeticKernels.h, so that templates instantiated
+//with this pack are never shared with another translation unit
+namespace {
+
+/**
+ * @brief Lane mask produced by packSSE2 comparisons.
+ */
+class maskSSE2 {
+public:
+    maskSSE2(__m128d _v) : v(_v) {}
+    __m128d v;
+};
+
+/**
+ * @brief Two doubles held in an SSE2 register.
+ */
+class packSSE2 {
+public:
+    typedef maskSSE2 mask;
+    static const int width = 2;
+    packSSE2() {}
+    packSSE2(__m128d _v) : v(_v) {}
+    packSSE2(double _s) : v(_mm_set1_pd(_s)) {}
+    static packSSE2 load(const double *_p) { return packSSE2(_mm_loadu_pd(_p)); }
+    void store(double *_p) const { _mm_storeu_pd(_p,v); }
+    __m128d v;
+};
+
+inline packSSE2 operator+(packSSE2 a, packSSE2 b) { return _mm_add_pd(a.v,b.v); }
+inline packSSE2 operator-(packSSE2 a, packSSE2 b) { return _mm_sub_pd(a.v,b.v); }
+inline packSSE2 operator*(packSSE2 a, packSSE2 b) { return _mm_mul_pd(a.v,b.v); }
+inline packSSE2 operator/(packSSE2 a, packSSE2 b) { return _mm_div_pd(a.v,b.v); }
+inline packSSE2 operator-(packSSE2 a) { return _mm_xor_pd(a.v,_mm_set1_pd(-0.0)); }
+inline maskSSE2 operator<(packSSE2 a, packSSE2 b) { return _mm_cmplt_pd(a.v,b.v); }
+inline maskSSE2 operator>(packSSE2 a, packSSE2 b) { return _mm_cmpgt_pd(a.v,b.v); }
+inline maskSSE2 operator<=(packSSE2 a, packSSE2 b) { return _mm_cmple_pd(a.v,b.v); }
+inline maskSSE2 operator>=(packSSE2 a, packSSE2 b) { return _mm_cmpge_pd(a.v,b.v); }
+inline maskSSE2 operator==(packSSE2 a, packSSE2 b) { return _mm_cmpeq_pd(a.v,b.v); }
+inline maskSSE2 operator&(maskSSE2 a, maskSSE2 b) { return _mm_and_pd(a.v,b.v); }
+inline maskSSE2 operator|(maskSSE2 a, maskSSE2 b) { return _mm_or_pd(a.v,b.v); }
+inline unsigned laneBits(maskSSE2 m) { return (unsigned) _mm_movemask_pd(m.v); }
+inline packSSE2 select(maskSSE2 m, packSSE2 a, packSSE2 b) {
+    return _mm_or_pd(_mm_and_pd(m.v,a.v),_mm_andnot_pd(m.v,b.v));
+}
+inline packSSE2 sqrt(packSSE2 a) { return _mm_sqrt_pd(a.v); }
+inline packSSE2 fabs(packSSE2 a) { return _mm_andnot_pd(_mm_set1_pd(-0.0),a.v); }
+inline packSSE2 fmin(packSSE2 a, packSSE2 b) { return _mm_min_pd(a.v,b.v); }
+inline packSSE2 fmax(packSSE2 a, packSSE2 b) { return _mm_max_pd(a.v,b.v); }
+inline packSSE2 cbrtEstimate(packSSE2 a) {
+    //single precision bit trick: divide the exponent by three
+    __m128i bits = _mm_castps_si128(_mm_cvtpd_ps(a.v));
+    bits = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(bits),_mm_set1_ps(1.0f/3.0f)));
+    bits = _mm_add_epi32(bits,_mm_set1_epi32(709958130));
+    return _mm_cvtps_pd(_mm_castsi128_ps(bits));
+}
+inline packSSE2 atan2(packSSE2 y, packSSE2 x) { return atan2Generic(y,x); }
+inline packSSE2 cbrt(packSSE2 a) { return cbrtGeneric(a); }
+}
+}
+}
+#endif	/* PACKSSE2_H */
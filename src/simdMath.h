@@ -0,0 +1,116 @@
+/**
+ * @brief Vectorized math building blocks.
+ * @file simdMath.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Generic arctangent and cube root routines written against the SIMD
+ * pack types (packSSE2.h, packAVX2.h, packAVX512.h). Each pack header forwards
+ * its atan2 and cbrt overloads here. Internal to the library.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#ifndef SIMDMATH_H
+#define	SIMDMATH_H
+
+#include "conversionKernels.h"
+
+namespace coordinateSystems {
+namespace kernels {
+
+/**
+ * @brief Arctangent of a pack with every lane in [0, 1].
+ *
+ * Cephes rational approximation (relative error about 1e-16); arguments above
+ * 0.66 are reduced with atan(x) = pi/4 + atan((x-1)/(x+1)).
+ */
+template <class P>
+inline P atanUnitGeneric(P x){
+    const double PIO4 = 7.85398163397448309616E-1;
+    const double MOREBITS = 6.123233995736765886130E-17;
+    typename P::mask reduce = x > P(0.66);
+    P t = select(reduce, (x - 1.0)/(x + 1.0), x);
+    P z = t*t;
+    P num = (((-8.750608600031904122785E-1*z - 1.615753718733365076637E1)*z
+        - 7.500855792314704667340E1)*z - 1.228866684490136173410E2)*z
+        - 6.485021904942025371773E1;
+    P den = ((((z + 2.485846490142306297962E1)*z + 1.650270098316988542046E2)*z
+        + 4.328810604912902668951E2)*z + 4.853903996359136964868E2)*z
+        + 1.945506571482613964425E2;
+    P r = t*(z*num/den) + t;
+    r = r + select(reduce, P(0.5*MOREBITS), P(0.0));
+    return select(reduce, PIO4 + r, r);
+}
+
+/**
+ * @brief Four quadrant arctangent of y/x for packs, branch free.
+ *
+ * Matches atan2 from math.h, including atan2(0, 0) = 0, except that a
+ * negative zero y is treated as positive.
+ */
+template <class P>
+inline P atan2Generic(P y, P x){
+    const double PIO2 = 1.57079632679489661923;
+    const double PI_ = 3.14159265358979323846;
+    P ax = fabs(x);
+    P ay = fabs(y);
+    P big = fmax(ax,ay);
+    P small = fmin(ax,ay);
+    P r = atanUnitGeneric(small/select(big == P(0.0), P(1.0), big));
+    r = select(ay > ax, PIO2 - r, r);
+    r = select(x < P(0.0), PI_ - r, r);
+    return select(y < P(0.0), -r, r);
+}
+
+/**
+ * @brief Cube root of a pack with positive lanes.
+ *
+ * Starts from the pack's single precision bit estimate (cbrtEstimate, a few
+ * percent) and refines with three Halley steps, y = y(y^3+2x)/(2y^3+x), each
+ * of which cubes the relative error.
+ */
+template <class P>
+inline P cbrtGeneric(P x){
+    P y = cbrtEstimate(fmin(fmax(x,P(1.0e-30)),P(1.0e30)));
+    for (int i = 0; i < 3; i++) {
+        P y3 = y*y*y;
+        y = y*(y3 + 2.0*x)/(2.0*y3 + x);
+    }
+    return y;
+}
+}
+}
+#endif	/* SIMDMATH_H */
@@ -0,0 +1,330 @@
+/**
+ * @brief Spatial index class implementation.
+ * @file spatialIndex.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Uniform grid over ECF points answering range and elevation mask
+ * queries from a site without converting every point to AER.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include <math.h>
+#include <algorithm>
+#include <stdexcept>
+#include "spatialIndex.h"
+#include "batchEngine.h"
+
+using namespace coordinateSystems;
+
+//outcome of testing a cell against the query region
+enum cellOverlap {OUTSIDE, PARTIAL, INSIDE};
+
+/*
+ * Squared distances from a point to the nearest and farthest points of an
+ * axis-aligned box.
+ */
+static void boxDistances(const double point[3], const double low[3], double size, double &nearest, double &farthest){
+    nearest = 0.0;
+    farthest = 0.0;
+    for (int i = 0; i < 3; i++) {
+        double below = low[i] - point[i];
+        double above = point[i] - (low[i] + size);
+        double gap = std::max(std::max(below,above),0.0);
+        double span = std::max(-below,-above);
+        nearest += gap*gap;
+        farthest += span*span;
+    }
+}
+
+/***** SpatialIndex ***********************************************************/
+SpatialIndex::SpatialIndex(double c) : cellSize(c), shards(shardCount){
+    if (!(c > 0)) {
+        throw std::runtime_error("Spatial index cell size must be positive");
+    }
+}
+SpatialIndex::~SpatialIndex(){
+}
+bool SpatialIndex::cellKey::operator==(const cellKey &other) const{
+    return x == other.x && y == other.y && z == other.z;
+}
+size_t SpatialIndex::cellHash::operator()(const cellKey &key) const{
+    const uint64_t mix = 0x9E3779B97F4A7C15ULL;
+    uint64_t h = (uint32_t) key.x;
+    h = h*mix + (uint32_t) key.y;
+    h = h*mix + (uint32_t) key.z;
+    h *= mix;
+    return (size_t) (h ^ (h >> 32));
+}
+SpatialIndex::cellKey SpatialIndex::keyOf(double x, double y, double z){
+    const double limit = 2147483647.0;
+    double cell[3] = {floor(x/cellSize), floor(y/cellSize), floor(z/cellSize)};
+    cellKey key;
+    for (int i = 0; i < 3; i++) {
+        cell[i] = std::min(std::max(cell[i],-limit),limit);
+    }
+    key.x = (int32_t) cell[0];
+    key.y = (int32_t) cell[1];
+    key.z = (int32_t) cell[2];
+    return key;
+}
+double SpatialIndex::getCellSize(){
+    return cellSize;
+}
+size_t SpatialIndex::size(){
+    size_t count = 0;
+    for (size_t s = 0; s < shardCount; s++) {
+        count += shards[s].locations.size();
+    }
+    return count;
+}
+size_t SpatialIndex::cellCount(){
+    size_t count = 0;
+    for (size_t s = 0; s < shardCount; s++) {
+        count += shards[s].cells.size();
+    }
+    return count;
+}
+void SpatialIndex::clear(){
+    for (size_t s = 0; s < shardCount; s++) {
+        shards[s].cells.clear();
+        shards[s].locations.clear();
+    }
+}
+void SpatialIndex::add(size_t id, const cellKey &key, double x, double y, double z){
+    entry point = {id, x, y, z};
+    shards[cellHash()(key) % shardCount].cells[key].push_back(point);
+    shards[id % shardCount].locations[id] = key;
+}
+void SpatialIndex::insert(size_t id, double x, double y, double z){
+    this->remove(id);
+    this->add(id,this->keyOf(x,y,z),x,y,z);
+}
+void SpatialIndex::insert(size_t id, ECF ecf){
+    this->insert(id,ecf.getFirstCoordinate(),ecf.getSecondCoordinate(),ecf.getThirdCoordinate());
+}
+bool SpatialIndex::remove(size_t id){
+    shard &home = shards[id % shardCount];
+    std::unordered_map<size_t, cellKey>::iterator location = home.locations.find(id);
+
+    if (location == home.locations.end()) {
+        return false;
+    }
+    cellMap &cells = shards[cellHash()(location->second) % shardCount].cells;
+    cellMap::iterator cell = cells.find(location->second);
+    std::vector<entry> &points = cell->second;
+    for (size_t i = 0; i < points.size(); i++) {
+        if (points[i].id == id) {
+            points[i] = points.back();
+            points.pop_back();
+            break;
+        }
+    }
+    if (points.empty()) {
+        cells.erase(cell);
+    }
+    home.locations.erase(location);
+    return true;
+}
+void SpatialIndex::build(size_t count, constCoordinateArray ecf, BatchEngine *engine){
+    std::vector<cellKey> keys(count);
+    std::vector<unsigned char> owner(count);
+    std::vector<size_t> start(shardCount+1,0), order(count);
+
+    this->clear();
+
+    //cell and shard of every point
+    auto locate = [&](size_t begin, size_t end){
+        for (size_t i = begin; i < end; i++) {
+            keys[i] = this->keyOf(ecf.first[i*ecf.stride],ecf.second[i*ecf.stride],ecf.third[i*ecf.stride]);
+            owner[i] = (unsigned char) (cellHash()(keys[i]) % shardCount);
+        }
+    };
+    //points grouped by shard so that each shard is filled by one task
+    auto fill = [&](size_t s){
+        shard &target = shards[s];
+        target.locations.reserve(count/shardCount + 1);
+        for (size_t k = start[s]; k < start[s+1]; k++) {
+            size_t i = order[k];
+            entry point = {i, ecf.first[i*ecf.stride], ecf.second[i*ecf.stride], ecf.third[i*ecf.stride]};
+            target.cells[keys[i]].push_back(point);
+        }
+        for (size_t i = s; i < count; i += shardCount) {
+            target.locations[i] = keys[i];
+        }
+    };
+
+    if (engine) {
+        engine->run(count,locate);
+    } else {
+        locate(0,count);
+    }
+    for (size_t i = 0; i < count; i++) {
+        start[owner[i]+1]++;
+    }
+    for (size_t s = 0; s < shardCount; s++) {
+        start[s+1] += start[s];
+    }
+    {
+        std::vector<size_t> next(start.begin(),start.end()-1);
+        for (size_t i = 0; i < count; i++) {
+            order[next[owner[i]]++] = i;
+        }
+    }
+    if (engine) {
+        //one chunk per shard: chunk boundaries are multiples of the chunk size
+        size_t chunk = engine->getChunkSize();
+        engine->run(shardCount*chunk,[&](size_t begin, size_t end){
+            for (size_t s = begin/chunk; s < (end + chunk - 1)/chunk; s++) {
+                fill(s);
+            }
+        });
+    } else {
+        for (size_t s = 0; s < shardCount; s++) {
+            fill(s);
+        }
+    }
+}
+template <class cellTest, class pointTest>
+void SpatialIndex::query(double x, double y, double z, double range, cellTest testCell, pointTest testPoint, std::vector<size_t> &ids){
+    auto visit = [&](const cellKey &key, const std::vector<entry> &points){
+        double low[3] = {key.x*cellSize, key.y*cellSize, key.z*cellSize};
+        cellOverlap overlap = testCell(low);
+        if (overlap == INSIDE) {
+            for (size_t i = 0; i < points.size(); i++) {
+                ids.push_back(points[i].id);
+            }
+        } else if (overlap == PARTIAL) {
+            for (size_t i = 0; i < points.size(); i++) {
+                if (testPoint(points[i])) {
+                    ids.push_back(points[i].id);
+                }
+            }
+        }
+    };
+
+    ids.clear();
+    if (range < HUGE_VAL) {
+        cellKey low = this->keyOf(x-range,y-range,z-range);
+        cellKey high = this->keyOf(x+range,y+range,z+range);
+        double boxCells = (high.x-(double)low.x+1)*(high.y-(double)low.y+1)*(high.z-(double)low.z+1);
+        if (boxCells <= this->cellCount()) {
+            //look up the cells of the bounding box of the range
+            cellKey key;
+            for (key.x = low.x; key.x <= high.x; key.x++) {
+                for (key.y = low.y; key.y <= high.y; key.y++) {
+                    for (key.z = low.z; key.z <= high.z; key.z++) {
+                        const cellMap &cells = shards[cellHash()(key) % shardCount].cells;
+                        cellMap::const_iterator cell = cells.find(key);
+                        if (cell != cells.end()) {
+                            visit(cell->first,cell->second);
+                        }
+                    }
+                }
+            }
+            return;
+        }
+    }
+    //fewer occupied cells than cells in range: test them all
+    for (size_t s = 0; s < shardCount; s++) {
+        for (cellMap::const_iterator cell = shards[s].cells.begin(); cell != shards[s].cells.end(); ++cell) {
+            visit(cell->first,cell->second);
+        }
+    }
+}
+void SpatialIndex::withinRange(ECF site, double range, std::vector<size_t> &ids){
+    double origin[3] = {site.getFirstCoordinate(), site.getSecondCoordinate(), site.getThirdCoordinate()};
+    double range2 = range*range;
+
+    auto testCell = [&](const double low[3]){
+        double nearest, farthest;
+        boxDistances(origin,low,cellSize,nearest,farthest);
+        return (nearest > range2) ? OUTSIDE : (farthest <= range2) ? INSIDE : PARTIAL;
+    };
+    auto testPoint = [&](const entry &point){
+        double dx = point.x-origin[0], dy = point.y-origin[1], dz = point.z-origin[2];
+        return dx*dx + dy*dy + dz*dz <= range2;
+    };
+    this->query(origin[0],origin[1],origin[2],range,testCell,testPoint,ids);
+}
+void SpatialIndex::aboveElevation(LocalFrame &site, double elevation, std::vector<size_t> &ids, double range){
+    ECF originECF = site.getOriginECF();
+    double origin[3] = {originECF.getFirstCoordinate(), originECF.getSecondCoordinate(), originECF.getThirdCoordinate()};
+    double R[3][3];
+    site.getRotation(R);
+    const double *up = R[2];
+    double sinMask = sin(elevation*deg2rad);
+    double cosMask = cos(elevation*deg2rad);
+    double range2 = range*range;
+    double radius = 0.5*sqrt(3.0)*cellSize; //of the sphere bounding a cell
+
+    //the mask is a cone around the up axis with a half angle of 90 - elevation,
+    //whose cosine is sinMask and sine cosMask; the bounding sphere of a cell
+    //spans an angle s around the direction of its centre
+    auto testCell = [&](const double low[3]){
+        double nearest, farthest, v[3], distance, cosAngle, sinSpread, cosSpread;
+        boxDistances(origin,low,cellSize,nearest,farthest);
+        if (nearest > range2) {
+            return OUTSIDE;
+        }
+        for (int i = 0; i < 3; i++) {
+            v[i] = low[i] + 0.5*cellSize - origin[i];
+        }
+        distance = sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+        if (distance <= radius) {
+            return PARTIAL;
+        }
+        cosAngle = (v[0]*up[0] + v[1]*up[1] + v[2]*up[2])/distance;
+        sinSpread = radius/distance;
+        cosSpread = sqrt(1.0 - sinSpread*sinSpread);
+        //outside when the angle exceeds the half angle + s (unless that reaches 180 degrees)
+        if (!(sinMask < 0 && sinSpread >= cosMask) && cosAngle < sinMask*cosSpread - cosMask*sinSpread) {
+            return OUTSIDE;
+        }
+        //inside when the angle is at most the half angle - s
+        if (!(sinMask >= 0 && sinSpread > cosMask) && cosAngle >= sinMask*cosSpread + cosMask*sinSpread && farthest <= range2) {
+            return INSIDE;
+        }
+        return PARTIAL;
+    };
+    auto testPoint = [&](const entry &point){
+        double dx = point.x-origin[0], dy = point.y-origin[1], dz = point.z-origin[2];
+        double distance2 = dx*dx + dy*dy + dz*dz;
+        double above = dx*up[0] + dy*up[1] + dz*up[2];
+        return distance2 <= range2 && above >= sqrt(distance2)*sinMask;
+    };
+    this->query(origin[0],origin[1],origin[2],range,testCell,testPoint,ids);
+}
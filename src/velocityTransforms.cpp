@@ -0,0 +1,187 @@
+/**
+ * @brief Velocity transformation implementation.
+ * @file velocityTransforms.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Batch conversions of positions and velocities together between the
+ * ECF, ENU, DCA and AER frames of a LocalFrame, and analytic azimuth,
+ * elevation and range rates.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+#include "velocityTransforms.h"
+#include "covarianceTransforms.h"
+#include "instrumentation.h"
+
+using namespace coordinateSystems;
+
+/***** helpers ****************************************************************/
+template <class V>
+static V load(const constCoordinateArray &array, size_t i){
+    size_t k = i*array.stride;
+    return V(array.first[k],array.second[k],array.third[k]);
+}
+template <class V>
+static void store(const coordinateArray &array, size_t i, V value){
+    size_t k = i*array.stride;
+    array.first[k] = value.first;
+    array.second[k] = value.second;
+    array.third[k] = value.third;
+}
+template <class Out, class In>
+static Out rotate(const double R[3][3], In v){
+    return Out(R[0][0]*v.first + R[0][1]*v.second + R[0][2]*v.third,
+            R[1][0]*v.first + R[1][1]*v.second + R[1][2]*v.third,
+            R[2][0]*v.first + R[2][1]*v.second + R[2][2]*v.third);
+}
+template <class Out, class In>
+static Out rotateBack(const double R[3][3], In v){
+    return Out(R[0][0]*v.first + R[1][0]*v.second + R[2][0]*v.third,
+            R[0][1]*v.first + R[1][1]*v.second + R[2][1]*v.third,
+            R[0][2]*v.first + R[1][2]*v.second + R[2][2]*v.third);
+}
+static void countBatch(size_t count){
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_CALLS,1);
+    COORDINATESYSTEMS_COUNT(COUNTER_BATCH_POINTS,count);
+    (void)count;
+}
+
+/***** rates ******************************************************************/
+AERVec coordinateSystems::dcaToAERRates(DCAVec position, DCAVec velocity){
+    double J[3][3];
+    dcaToAERJacobian(position.first,position.second,position.third,J);
+    return rotate<AERVec>(J,velocity);
+}
+DCAVec coordinateSystems::aerToDCARates(AERVec position, AERVec rates){
+    double J[3][3];
+    aerToDCAJacobian(position.first,position.second,position.third,J);
+    return rotate<DCAVec>(J,rates);
+}
+
+/***** batch ******************************************************************/
+void coordinateSystems::ecfToENUVelocity(size_t count, constCoordinateArray positions, constCoordinateArray velocities,
+        coordinateArray outPositions, coordinateArray outVelocities, LocalFrame &frame){
+    double R[3][3];
+    frame.getRotation(R);
+    countBatch(count);
+    for (size_t i = 0; i < count; i++) {
+        ENUVec position = frame.toENU(load<ECFVec>(positions,i));
+        ENUVec velocity = rotate<ENUVec>(R,load<ECFVec>(velocities,i));
+        store(outPositions,i,position);
+        store(outVelocities,i,velocity);
+    }
+}
+void coordinateSystems::enuToECFVelocity(size_t count, constCoordinateArray positions, constCoordinateArray velocities,
+        coordinateArray outPositions, coordinateArray outVelocities, LocalFrame &frame){
+    double R[3][3];
+    frame.getRotation(R);
+    countBatch(count);
+    for (size_t i = 0; i < count; i++) {
+        ECFVec position = frame.toECF(load<ENUVec>(positions,i));
+        ECFVec velocity = rotateBack<ECFVec>(R,load<ENUVec>(velocities,i));
+        store(outPositions,i,position);
+        store(outVelocities,i,velocity);
+    }
+}
+void coordinateSystems::ecfToDCAVelocity(size_t count, constCoordinateArray positions, constCoordinateArray velocities,
+        coordinateArray outPositions, coordinateArray outVelocities, LocalFrame &frame){
+    double R[3][3];
+    frame.getDCARotation(R);
+    countBatch(count);
+    for (size_t i = 0; i < count; i++) {
+        DCAVec position = frame.toDCA(load<ECFVec>(positions,i));
+        DCAVec velocity = rotate<DCAVec>(R,load<ECFVec>(velocities,i));
+        store(outPositions,i,position);
+        store(outVelocities,i,velocity);
+    }
+}
+void coordinateSystems::dcaToECFVelocity(size_t count, constCoordinateArray positions, constCoordinateArray velocities,
+        coordinateArray outPositions, coordinateArray outVelocities, LocalFrame &frame){
+    double R[3][3];
+    frame.getDCARotation(R);
+    countBatch(count);
+    for (size_t i = 0; i < count; i++) {
+        ECFVec position = frame.toECF(load<DCAVec>(positions,i));
+        ECFVec velocity = rotateBack<ECFVec>(R,load<DCAVec>(velocities,i));
+        store(outPositions,i,position);
+        store(outVelocities,i,velocity);
+    }
+}
+void coordinateSystems::dcaToAERVelocity(size_t count, constCoordinateArray positions, constCoordinateArray velocities,
+        coordinateArray outPositions, coordinateArray outRates){
+    countBatch(count);
+    for (size_t i = 0; i < count; i++) {
+        DCAVec dca = load<DCAVec>(positions,i);
+        AERVec rates = dcaToAERRates(dca,load<DCAVec>(velocities,i));
+        store(outPositions,i,toAER(dca));
+        store(outRates,i,rates);
+    }
+}
+void coordinateSystems::aerToDCAVelocity(size_t count, constCoordinateArray positions, constCoordinateArray rates,
+        coordinateArray outPositions, coordinateArray outVelocities){
+    countBatch(count);
+    for (size_t i = 0; i < count; i++) {
+        AERVec aer = load<AERVec>(positions,i);
+        DCAVec velocity = aerToDCARates(aer,load<AERVec>(rates,i));
+        store(outPositions,i,toDCA(aer));
+        store(outVelocities,i,velocity);
+    }
+}
+void coordinateSystems::ecfToAERVelocity(size_t count, constCoordinateArray positions, constCoordinateArray velocities,
+        coordinateArray outPositions, coordinateArray outRates, LocalFrame &frame){
+    double R[3][3];
+    frame.getDCARotation(R);
+    countBatch(count);
+    for (size_t i = 0; i < count; i++) {
+        DCAVec dca = frame.toDCA(load<ECFVec>(positions,i));
+        AERVec rates = dcaToAERRates(dca,rotate<DCAVec>(R,load<ECFVec>(velocities,i)));
+        store(outPositions,i,toAER(dca));
+        store(outRates,i,rates);
+    }
+}
+void coordinateSystems::aerToECFVelocity(size_t count, constCoordinateArray positions, constCoordinateArray rates,
+        coordinateArray outPositions, coordinateArray outVelocities, LocalFrame &frame){
+    double R[3][3];
+    frame.getDCARotation(R);
+    countBatch(count);
+    for (size_t i = 0; i < count; i++) {
+        AERVec aer = load<AERVec>(positions,i);
+        DCAVec velocity = aerToDCARates(aer,load<AERVec>(rates,i));
+        store(outPositions,i,frame.toECF(toDCA(aer)));
+        store(outVelocities,i,rotateBack<ECFVec>(R,velocity));
+    }
+}
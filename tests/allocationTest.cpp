@@ -0,0 +1,201 @@
+/**
+ * @brief Allocation tester implementation.
+ * @file allocationTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing that the accessors and the conversion paths do
+ * not allocate heap memory, through a counting replacement of the global
+ * operator new.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <stdlib.h>
+#include <new>
+#include <vector>
+#include "allocationTest.h"
+#include "include/coordinateSystems.h"
+#include "include/localFrame.h"
+#include "include/batchConversions.h"
+#include "include/geodeticTrack.h"
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(allocationTest);
+
+/*
+ * Test hook: the global operator new is replaced for the whole test program
+ * and counts the allocations made by the current thread while counting is
+ * on. Assertions allocate, so they are made after counting stops.
+ */
+static thread_local bool counting = false;
+static thread_local size_t allocations = 0;
+
+//inlined into a new-expression, the free below looks mismatched to GCC 11 and later
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void *operator new(size_t size){
+    if (counting) {
+        allocations++;
+    }
+    void *p = malloc(size ? size : 1);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+void *operator new[](size_t size){
+    return operator new(size);
+}
+void operator delete(void *p) noexcept{
+    free(p);
+}
+void operator delete[](void *p) noexcept{
+    free(p);
+}
+void operator delete(void *p, size_t) noexcept{
+    free(p);
+}
+void operator delete[](void *p, size_t) noexcept{
+    free(p);
+}
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+static void startCounting(){
+    allocations = 0;
+    counting = true;
+}
+static size_t stopCounting(){
+    counting = false;
+    return allocations;
+}
+
+allocationTest::allocationTest() {
+}
+
+allocationTest::~allocationTest() {
+}
+
+void allocationTest::setUp() {
+}
+
+void allocationTest::tearDown() {
+}
+
+void allocationTest::testHook() {
+    startCounting();
+    std::vector<double> *buffer = new std::vector<double>(3);
+    delete buffer;
+    CPPUNIT_ASSERT_EQUAL((size_t) 2,stopCounting());
+}
+
+void allocationTest::testAccessors() {
+    ENU enu(1.0,2.0,3.0,38.0,-77.0,100.0);
+    double position[3];
+
+    startCounting();
+    std::array<double, 3> coordinates = enu.getCoordinates();
+    enu.getPosition(position);
+    LLA origin = enu.getOrigin();
+    size_t count = stopCounting();
+    CPPUNIT_ASSERT_EQUAL((size_t) 0,count);
+    CPPUNIT_ASSERT_EQUAL(2.0,coordinates[1]);
+    CPPUNIT_ASSERT_EQUAL(3.0,position[2]);
+    CPPUNIT_ASSERT_EQUAL(-77.0,origin.getSecondCoordinate());
+
+    //the vector accessor still allocates
+    startCounting();
+    std::vector<double> vector = enu.getPosition();
+    count = stopCounting();
+    CPPUNIT_ASSERT_EQUAL((size_t) 1,count);
+    CPPUNIT_ASSERT_EQUAL(1.0,vector[0]);
+}
+
+void allocationTest::testClassConversions() {
+    LLA origin(38.0,-77.0,100.0);
+    LLA lla(38.5,-76.5,2000.0);
+    double sum = 0.0, latitude, longitude, altitude;
+    //interning a new frame allocates, conversions in a live frame do not
+    ENU enuFrame(origin);
+    DCA dcaFrame(origin,30.0);
+
+    startCounting();
+    ECF ecf = lla.toECF();
+    sum += ecf.toLLA().getFirstCoordinate();
+    for (int solver = GEODETIC_ITERATIVE; solver <= GEODETIC_CLOSED_FORM; solver++) {
+        ECF::toLLA(ecf.getFirstCoordinate(),ecf.getSecondCoordinate(),ecf.getThirdCoordinate(),
+                latitude,longitude,altitude,(geodeticSolver)solver);
+        sum += latitude;
+    }
+    ENU enu = ecf.toENU(origin);
+    DCA dca = ecf.toDCA(38.0,-77.0,100.0,30.0);
+    AER aer = lla.toAER(origin,30.0);
+    sum += lla.toENU(origin).getFirstCoordinate() + lla.toDCA(origin,30.0).getFirstCoordinate();
+    sum += enu.toECF().getFirstCoordinate() + enu.toLLA().getFirstCoordinate();
+    sum += enu.toDCA(30.0).getFirstCoordinate() + enu.toAER(30.0).getFirstCoordinate();
+    sum += dca.toECF().getFirstCoordinate() + dca.toLLA().getFirstCoordinate();
+    sum += dca.toENU().getFirstCoordinate() + dca.toAER().getFirstCoordinate();
+    sum += aer.toECF().getFirstCoordinate() + aer.toLLA().getFirstCoordinate();
+    sum += aer.toENU().getFirstCoordinate() + aer.toDCA().getFirstCoordinate();
+    sum += lla.getMagnitude() + enu.getMagnitude() + aer.getMagnitude();
+    size_t count = stopCounting();
+    CPPUNIT_ASSERT_EQUAL((size_t) 0,count);
+    CPPUNIT_ASSERT(sum == sum);
+}
+
+void allocationTest::testLocalFrame() {
+    LLA lla(38.5,-76.5,2000.0);
+    ECF ecf = lla.toECF();
+    double sum = 0.0;
+
+    LocalFrame frame(38.0,-77.0,100.0,30.0);
+    startCounting();
+    ENU enu = frame.toENU(ecf);
+    DCA dca = frame.toDCA(lla);
+    AER aer = frame.toAER(ecf);
+    sum += frame.toECF(enu).getFirstCoordinate() + frame.toECF(dca).getFirstCoordinate();
+    sum += frame.toECF(aer).getFirstCoordinate() + frame.toLLA(aer).getFirstCoordinate();
+    sum += frame.toDCA(enu).getFirstCoordinate() + frame.toAER(enu).getFirstCoordinate();
+    sum += frame.toENU(dca).getFirstCoordinate() + frame.toENU(aer).getFirstCoordinate();
+    AERVec vec = frame.toAER(ECFVec(ecf.getFirstCoordinate(),ecf.getSecondCoordinate(),ecf.getThirdCoordinate()));
+    sum += frame.toECF(vec).first;
+    size_t count = stopCounting();
+    CPPUNIT_ASSERT_EQUAL((size_t) 0,count);
+    CPPUNIT_ASSERT(sum == sum);
+}
+
+void allocationTest::testBatchConversions() {
+    const size_t n = 300;
+    double lla[3*n], ecf[3*n], local[3*n];
+    uint64_t visible[(n+63)/64];
+    double elevations[3] = {0.0, 5.0, 10.0};
+    LocalFrame frame(38.0,-77.0,100.0,30.0);
+    GeodeticTrack track;
+    for (size_t i = 0; i < n; i++) {
+        lla[3*i] = 38.0 + 0.01*i;
+        lla[3*i+1] = -77.0 + 0.01*i;
+        lla[3*i+2] = 10.0*i;
+    }
+
+    simdLevel saved = getSimdLevel();
+    startCounting();
+    for (int level = SIMD_NONE; level <= SIMD_AVX512; level++) {
+        setSimdLevel((simdLevel)level);
+        llaToECF(n,lla,ecf);
+        ecfToLLA(n,ecf,local);
+        ecfToAER(n,ecf,local,frame);
+        aerToLLA(n,local,local,frame);
+        llaToENU(n,lla,local,frame);
+        enuToDCA(n,local,local,frame);
+        ecfVisibility(n,ecf,frame,3,elevations,1.0e6,visible);
+    }
+    track.toLLA(n,ecf,local);
+    size_t count = stopCounting();
+    setSimdLevel(saved);
+    CPPUNIT_ASSERT_EQUAL((size_t) 0,count);
+}
@@ -0,0 +1,44 @@
+/**
+ * @brief Allocation tester definition.
+ * @file allocationTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing that the accessors and the conversion paths do
+ * not allocate heap memory, through a counting replacement of the global
+ * operator new.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef ALLOCATIONTEST_H
+#define	ALLOCATIONTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class allocationTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(allocationTest);
+
+    CPPUNIT_TEST(testHook);
+    CPPUNIT_TEST(testAccessors);
+    CPPUNIT_TEST(testClassConversions);
+    CPPUNIT_TEST(testLocalFrame);
+    CPPUNIT_TEST(testBatchConversions);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    allocationTest();
+    virtual ~allocationTest();
+    void setUp();
+    void tearDown();
+
+private:
+    void testHook();
+    void testAccessors();
+    void testClassConversions();
+    void testLocalFrame();
+    void testBatchConversions();
+};
+
+#endif	/* ALLOCATIONTEST_H */
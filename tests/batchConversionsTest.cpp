@@ -0,0 +1,580 @@
+/**
+ * @brief Batch conversion tester implementation.
+ * @file batchConversionsTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the batch conversions against the coordinate
+ * systems class conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "batchConversionsTest.h"
+#include "include/batchConversions.h"
+#include "include/batchEngine.h"
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(batchConversionsTest);
+
+batchConversionsTest::batchConversionsTest() {
+}
+
+batchConversionsTest::~batchConversionsTest() {
+}
+
+void batchConversionsTest::setUp() {
+    double b = sqrt(pow(6378137.0,2)*(1-0.00669437999014));
+    double ecf[batchCount][3] = {
+        {6378137.0+1000, 2000.0, 300.0},
+        {0.0, 6378137.0, 0.0},
+        {0.0, 0.0, -b-300.0},
+        {-3000000.0, 4000000.0, 3500000.0},
+        {1200000.0, -5500000.0, -2900000.0}
+    };
+    double local[batchCount][3] = {
+        {1111.11, 222.22, 333.33},
+        {-5000.0, 12000.0, -40.0},
+        {0.0, 0.0, 100.0},
+        {0.0, 0.0, 0.0},
+        {45.0, 30.0, 555.55}
+    };
+    for (int i = 0; i < batchCount; i++) {
+        for (int j = 0; j < 3; j++) {
+            _ecf[i][j] = ecf[i][j];
+            _local[i][j] = local[i][j];
+        }
+        LLA lla = ECF(_ecf[i][0],_ecf[i][1],_ecf[i][2]).toLLA();
+        _lla[i][0] = lla.getFirstCoordinate();
+        _lla[i][1] = lla.getSecondCoordinate();
+        _lla[i][2] = lla.getThirdCoordinate();
+    }
+    _latitude = 10.0;
+    _longitude = 20.0;
+    _altitude = 30.0;
+    _heading = 55.5;
+}
+
+void batchConversionsTest::tearDown() {
+}
+
+void batchConversionsTest::testCoordinateArray() {
+    double first[2], second[2], third[2];
+    double interleaved[6];
+    coordinateArray soa(first,second,third);
+    coordinateArray aos(interleaved);
+    constCoordinateArray view(aos);
+
+    CPPUNIT_ASSERT(soa.first == first);
+    CPPUNIT_ASSERT(soa.second == second);
+    CPPUNIT_ASSERT(soa.third == third);
+    CPPUNIT_ASSERT_EQUAL((size_t)1,soa.stride);
+    CPPUNIT_ASSERT(aos.first == interleaved);
+    CPPUNIT_ASSERT(aos.second == interleaved+1);
+    CPPUNIT_ASSERT(aos.third == interleaved+2);
+    CPPUNIT_ASSERT_EQUAL((size_t)3,aos.stride);
+    CPPUNIT_ASSERT(view.second == interleaved+1);
+    CPPUNIT_ASSERT_EQUAL((size_t)3,view.stride);
+}
+
+void batchConversionsTest::testECFToLLA() {
+    double lat[batchCount], lon[batchCount], alt[batchCount];
+    ecfToLLA(batchCount,&_ecf[0][0],coordinateArray(lat,lon,alt));
+    for (int i = 0; i < batchCount; i++) {
+        ECF roundTrip = LLA(lat[i],lon[i],alt[i]).toECF();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][0],roundTrip.getFirstCoordinate(),piTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][1],roundTrip.getSecondCoordinate(),piTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][2],roundTrip.getThirdCoordinate(),piTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_lla[i][1],lon[i],batchTol);
+    }
+}
+
+void batchConversionsTest::testSimdLevel() {
+    simdLevel saved = getSimdLevel();
+
+    CPPUNIT_ASSERT_EQUAL(getSupportedSimdLevel(),saved);
+    setSimdLevel(SIMD_NONE);
+    CPPUNIT_ASSERT_EQUAL(SIMD_NONE,getSimdLevel());
+    setSimdLevel(SIMD_AVX512);
+    CPPUNIT_ASSERT_EQUAL(getSupportedSimdLevel(),getSimdLevel());
+    setSimdLevel(saved);
+}
+
+void batchConversionsTest::testClosedFormAccuracy() {
+    const int count = 7*19*5; //not a multiple of any vector width
+    double latitudes[7] = {-90.0, -89.9999, -45.0, 0.0, 0.001, 60.0, 90.0};
+    double altitudes[5] = {-6000.0, 0.0, 8848.0, 400000.0, 36000000.0};
+    std::vector<double> lla(3*count), ecf(3*count), result(3*count);
+    std::vector<double> x(count), y(count), z(count);
+    simdLevel saved = getSimdLevel();
+    int n = 0;
+
+    for (int i = 0; i < 7; i++) {
+        for (int j = 0; j < 19; j++) {
+            for (int k = 0; k < 5; k++, n++) {
+                lla[3*n] = latitudes[i];
+                lla[3*n+1] = -180.0+20.0*j;
+                lla[3*n+2] = altitudes[k];
+            }
+        }
+    }
+    llaToECF(count,&lla[0],&ecf[0]);
+    for (n = 0; n < count; n++) {
+        x[n] = ecf[3*n];
+        y[n] = ecf[3*n+1];
+        z[n] = ecf[3*n+2];
+    }
+
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        setSimdLevel((simdLevel)level);
+        //structure of arrays in, interleaved out
+        ecfToLLA(count,constCoordinateArray(&x[0],&y[0],&z[0]),&result[0]);
+        for (n = 0; n < count; n++) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(lla[3*n+2],result[3*n+2],closedFormTol);
+        }
+        llaToECF(count,&result[0],&result[0]);
+        for (n = 0; n < 3*count; n++) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(ecf[n],result[n],closedFormTol);
+        }
+        //interleaved in place, strided through every other point
+        result = ecf;
+        ecfToLLA((count+1)/2,coordinateArray(&result[0],&result[1],&result[2],6),
+                coordinateArray(&result[0],&result[1],&result[2],6));
+        for (n = 0; n < count; n++) {
+            if (n % 2) {
+                CPPUNIT_ASSERT_EQUAL(ecf[3*n],result[3*n]);
+            } else {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(lla[3*n+2],result[3*n+2],closedFormTol);
+            }
+        }
+    }
+    setSimdLevel(saved);
+}
+
+void batchConversionsTest::testClosedFormCentre() {
+    //every vector width agrees with the iterative solver at and near the centre
+    const int count = 11;
+    double x[count] = {0.0, 1.0, 1000.0, 0.0, 0.0, -20000.0, 0.0, 3.0, 0.0, 35000.0, 1.0e-3};
+    double y[count] = {0.0, 0.0, 1000.0, 0.0, 0.0, 5000.0, 0.0, 0.0, 1.0, -2000.0, 0.0};
+    double z[count] = {0.0, 0.0, 0.0, 1.0, -1.0, 0.0, 30000.0, 0.0, 0.0, 0.0, 0.0};
+    double lat[count], lon[count], alt[count];
+    simdLevel saved = getSimdLevel();
+
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        setSimdLevel((simdLevel)level);
+        ecfToLLA(count,constCoordinateArray(x,y,z),coordinateArray(lat,lon,alt));
+        for (int i = 0; i < count; i++) {
+            double latitude, longitude, altitude;
+            ECF::toLLA(x[i],y[i],z[i],latitude,longitude,altitude,GEODETIC_ITERATIVE);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(latitude,lat[i],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(longitude,lon[i],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(altitude,alt[i],closedFormTol);
+        }
+    }
+    setSimdLevel(saved);
+}
+
+void batchConversionsTest::testLLAToECF() {
+    double result[batchCount][3];
+    llaToECF(batchCount,&_lla[0][0],&result[0][0]);
+    for (int i = 0; i < batchCount; i++) {
+        ECF expected = LLA(_lla[i][0],_lla[i][1],_lla[i][2]).toECF();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],piTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],piTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],piTol);
+    }
+}
+
+void batchConversionsTest::testLLAToECFSimdLevels() {
+    const int count = 23*9;
+    std::vector<double> lla(3*count), reference(3*count), result(3*count);
+    simdLevel saved = getSimdLevel();
+    int n = 0;
+
+    for (int i = 0; i < 23; i++) {
+        for (int j = 0; j < 9; j++, n++) {
+            lla[3*n] = -90.0+45.0*(j%5)+0.37*(j/5);
+            lla[3*n+1] = -720.0+67.5*i; //angles beyond one turn are reduced exactly
+            lla[3*n+2] = 100.0*i-500.0;
+        }
+    }
+    for (n = 0; n < count; n++) {
+        ECF expected = LLA(lla[3*n],lla[3*n+1],lla[3*n+2]).toECF();
+        reference[3*n] = expected.getFirstCoordinate();
+        reference[3*n+1] = expected.getSecondCoordinate();
+        reference[3*n+2] = expected.getThirdCoordinate();
+    }
+
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        setSimdLevel((simdLevel)level);
+        llaToECF(count,constCoordinateArray(&lla[0],&lla[1],&lla[2],3),
+                coordinateArray(&result[0],&result[count],&result[2*count]));
+        for (n = 0; n < count; n++) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(reference[3*n],result[n],piTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(reference[3*n+1],result[count+n],piTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(reference[3*n+2],result[2*count+n],piTol);
+        }
+    }
+    //the poles and multiples of 90 degrees of longitude land exactly on the axes
+    setSimdLevel(saved);
+    double poles[4][3] = {{90.0, 0.0, 0.0}, {-90.0, 90.0, 0.0}, {0.0, 180.0, 0.0}, {0.0, -270.0, 0.0}};
+    llaToECF(4,&poles[0][0],&poles[0][0]);
+    CPPUNIT_ASSERT_EQUAL(0.0,poles[0][0]);
+    CPPUNIT_ASSERT_EQUAL(0.0,poles[1][1]);
+    CPPUNIT_ASSERT_EQUAL(-6378137.0,poles[2][0]);
+    CPPUNIT_ASSERT_EQUAL(0.0,poles[2][1]);
+    CPPUNIT_ASSERT_EQUAL(6378137.0,poles[3][1]);
+}
+
+void batchConversionsTest::testECFToENU() {
+    LocalFrame frame(_latitude,_longitude,_altitude);
+    double result[batchCount][3];
+    ecfToENU(batchCount,&_ecf[0][0],&result[0][0],frame);
+    for (int i = 0; i < batchCount; i++) {
+        ENU expected = ECF(_ecf[i][0],_ecf[i][1],_ecf[i][2]).toENU(_latitude,_longitude,_altitude);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testENUToECF() {
+    LocalFrame frame(_latitude,_longitude,_altitude);
+    double result[batchCount][3];
+    enuToECF(batchCount,&_local[0][0],&result[0][0],frame);
+    for (int i = 0; i < batchCount; i++) {
+        ECF expected = ENU(_local[i][0],_local[i][1],_local[i][2],_latitude,_longitude,_altitude).toECF();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testENUToDCA() {
+    double result[batchCount][3];
+    enuToDCA(batchCount,&_local[0][0],&result[0][0],_heading);
+    for (int i = 0; i < batchCount; i++) {
+        DCA expected = ENU(_local[i][0],_local[i][1],_local[i][2]).toDCA(_heading);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testDCAToENU() {
+    double result[batchCount][3];
+    dcaToENU(batchCount,&_local[0][0],&result[0][0],_heading);
+    for (int i = 0; i < batchCount; i++) {
+        ENU expected = DCA(_local[i][0],_local[i][1],_local[i][2],_heading).toENU();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testDCAToAER() {
+    double result[batchCount][3];
+    dcaToAER(batchCount,&_local[0][0],&result[0][0]);
+    for (int i = 0; i < batchCount; i++) {
+        AER expected = DCA(_local[i][0],_local[i][1],_local[i][2]).toAER();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testAERToDCA() {
+    double result[batchCount][3];
+    aerToDCA(batchCount,&_local[0][0],&result[0][0]);
+    for (int i = 0; i < batchCount; i++) {
+        DCA expected = AER(_local[i][0],_local[i][1],_local[i][2]).toDCA();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testECFToAER() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    double az[batchCount], el[batchCount], range[batchCount];
+    ecfToAER(batchCount,&_ecf[0][0],coordinateArray(az,el,range),frame);
+    for (int i = 0; i < batchCount; i++) {
+        AER expected = ECF(_ecf[i][0],_ecf[i][1],_ecf[i][2]).toAER(_latitude,_longitude,_altitude,_heading);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),az[i],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),el[i],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),range[i],batchTol);
+    }
+}
+
+void batchConversionsTest::testLLAToAER() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    double result[batchCount][3];
+    llaToAER(batchCount,&_lla[0][0],&result[0][0],frame);
+    for (int i = 0; i < batchCount; i++) {
+        AER expected = LLA(_lla[i][0],_lla[i][1],_lla[i][2]).toAER(_latitude,_longitude,_altitude,_heading);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testAERToLLA() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    double result[batchCount][3];
+    aerToLLA(batchCount,&_local[0][0],&result[0][0],frame);
+    llaToECF(batchCount,&result[0][0],&result[0][0]);
+    for (int i = 0; i < batchCount; i++) {
+        ECF expected = AER(_local[i][0],_local[i][1],_local[i][2],_latitude,_longitude,_altitude,_heading).toECF();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testComposedRoundTrips() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    double first[batchCount], second[batchCount], third[batchCount];
+    double result[batchCount][3];
+    coordinateArray soa(first,second,third);
+
+    llaToENU(batchCount,&_lla[0][0],soa,frame);
+    enuToLLA(batchCount,soa,&result[0][0],frame);
+    llaToECF(batchCount,&result[0][0],&result[0][0]);
+    for (int i = 0; i < batchCount; i++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][0],result[i][0],geodeticTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][1],result[i][1],geodeticTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][2],result[i][2],geodeticTol);
+    }
+
+    llaToDCA(batchCount,&_lla[0][0],soa,frame);
+    dcaToLLA(batchCount,soa,&result[0][0],frame);
+    llaToECF(batchCount,&result[0][0],&result[0][0]);
+    for (int i = 0; i < batchCount; i++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][0],result[i][0],geodeticTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][1],result[i][1],geodeticTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][2],result[i][2],geodeticTol);
+    }
+
+    ecfToDCA(batchCount,&_ecf[0][0],soa,frame);
+    dcaToECF(batchCount,soa,&result[0][0],frame);
+    for (int i = 0; i < batchCount; i++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][0],result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][1],result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_ecf[i][2],result[i][2],batchTol);
+    }
+
+    aerToECF(batchCount,&_local[0][0],soa,frame);
+    ecfToAER(batchCount,soa,&result[0][0],frame);
+    aerToENU(batchCount,&result[0][0],soa,_heading);
+    enuToAER(batchCount,soa,&result[0][0],_heading);
+    aerToDCA(batchCount,&result[0][0],&result[0][0]);
+    for (int i = 0; i < batchCount; i++) {
+        DCA expected = AER(_local[i][0],_local[i][1],_local[i][2]).toDCA();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result[i][0],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result[i][1],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result[i][2],batchTol);
+    }
+}
+
+void batchConversionsTest::testFusedSimdLevels() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    double aer[batchCount][3], lla[batchCount][3], enu[batchCount][3];
+    simdLevel saved = getSimdLevel();
+
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        setSimdLevel((simdLevel)level);
+        llaToAER(batchCount,&_lla[0][0],&aer[0][0],frame);
+        aerToLLA(batchCount,&_local[0][0],&lla[0][0],frame);
+        enuToAER(batchCount,&_local[0][0],&enu[0][0],_heading);
+        for (int i = 0; i < batchCount; i++) {
+            AER expected = LLA(_lla[i][0],_lla[i][1],_lla[i][2]).toAER(_latitude,_longitude,_altitude,_heading);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),aer[i][0],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),aer[i][1],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),aer[i][2],piTol);
+
+            ECF target = AER(_local[i][0],_local[i][1],_local[i][2],_latitude,_longitude,_altitude,_heading).toECF();
+            ECF result = LLA(lla[i][0],lla[i][1],lla[i][2]).toECF();
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(target.getFirstCoordinate(),result.getFirstCoordinate(),piTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(target.getSecondCoordinate(),result.getSecondCoordinate(),piTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(target.getThirdCoordinate(),result.getThirdCoordinate(),piTol);
+
+            AER direct = ENU(_local[i][0],_local[i][1],_local[i][2]).toAER(_heading);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(direct.getFirstCoordinate(),enu[i][0],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(direct.getSecondCoordinate(),enu[i][1],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(direct.getThirdCoordinate(),enu[i][2],batchTol);
+        }
+    }
+    setSimdLevel(saved);
+}
+
+void batchConversionsTest::testSensorFrameSimdLevels() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    double dca[batchCount][3], enu[batchCount][3], aer[batchCount][3], back[batchCount][3];
+    simdLevel saved = getSimdLevel();
+
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        setSimdLevel((simdLevel)level);
+        enuToDCA(batchCount,&_local[0][0],&dca[0][0],frame);
+        dcaToENU(batchCount,&_local[0][0],&enu[0][0],frame);
+        enuToAER(batchCount,&_local[0][0],&aer[0][0],frame);
+        aerToENU(batchCount,&aer[0][0],&back[0][0],frame);
+        for (int i = 0; i < batchCount; i++) {
+            DCA expectedDCA = ENU(_local[i][0],_local[i][1],_local[i][2]).toDCA(_heading);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedDCA.getFirstCoordinate(),dca[i][0],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedDCA.getSecondCoordinate(),dca[i][1],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedDCA.getThirdCoordinate(),dca[i][2],batchTol);
+
+            ENU expectedENU = DCA(_local[i][0],_local[i][1],_local[i][2],_heading).toENU();
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU.getFirstCoordinate(),enu[i][0],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU.getSecondCoordinate(),enu[i][1],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU.getThirdCoordinate(),enu[i][2],batchTol);
+
+            AER expectedAER = ENU(_local[i][0],_local[i][1],_local[i][2]).toAER(_heading);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedAER.getFirstCoordinate(),aer[i][0],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedAER.getSecondCoordinate(),aer[i][1],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedAER.getThirdCoordinate(),aer[i][2],batchTol);
+
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(_local[i][0],back[i][0],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(_local[i][1],back[i][1],batchTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(_local[i][2],back[i][2],batchTol);
+        }
+    }
+    setSimdLevel(saved);
+}
+
+void batchConversionsTest::testInPlace() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    double points[batchCount][3];
+    double expected[batchCount][3];
+
+    for (int i = 0; i < batchCount; i++) {
+        for (int j = 0; j < 3; j++) {
+            points[i][j] = _ecf[i][j];
+        }
+    }
+    ecfToAER(batchCount,&_ecf[0][0],&expected[0][0],frame);
+    ecfToAER(batchCount,&points[0][0],&points[0][0],frame);
+    for (int i = 0; i < batchCount; i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i][0],points[i][0]);
+        CPPUNIT_ASSERT_EQUAL(expected[i][1],points[i][1]);
+        CPPUNIT_ASSERT_EQUAL(expected[i][2],points[i][2]);
+    }
+}
+
+void batchConversionsTest::testLookAngleMatrix() {
+    //more targets than one cache block, sensors with different headings
+    const size_t sensorCount = 3, targetCount = lookAngleBlock + 77;
+    std::vector<LocalFrame> sensors;
+    sensors.push_back(LocalFrame(_latitude,_longitude,_altitude,_heading));
+    sensors.push_back(LocalFrame(-33.9,151.2,50.0,0.0));
+    sensors.push_back(LocalFrame(64.8,-147.7,130.0,270.0));
+    std::vector<double> lla(3*targetCount), ecf(3*targetCount);
+    for (size_t t = 0; t < targetCount; t++) {
+        lla[3*t] = fmod(t*0.731,180.0) - 90.0;
+        lla[3*t+1] = fmod(t*1.377,360.0) - 180.0;
+        lla[3*t+2] = fmod(t*911.0,800000.0);
+    }
+    llaToECF(targetCount,&lla[0],&ecf[0]);
+
+    std::vector<double> expected(3*sensorCount*targetCount);
+    for (size_t s = 0; s < sensorCount; s++) {
+        ecfToAER(targetCount,&ecf[0],&expected[3*s*targetCount],sensors[s]);
+    }
+
+    //interleaved output
+    std::vector<double> aer(3*sensorCount*targetCount);
+    ecfToAERMatrix(sensorCount,&sensors[0],targetCount,&ecf[0],&aer[0]);
+    for (size_t i = 0; i < aer.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],aer[i]);
+    }
+
+    //separate azimuth, elevation and range matrices, LLA targets, on an engine
+    BatchEngine engine(3,100);
+    std::vector<double> azimuth(sensorCount*targetCount), elevation(sensorCount*targetCount), range(sensorCount*targetCount);
+    llaToAERMatrix(sensorCount,&sensors[0],targetCount,&lla[0],
+            coordinateArray(&azimuth[0],&elevation[0],&range[0]),&engine);
+    for (size_t i = 0; i < sensorCount*targetCount; i++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[3*i],azimuth[i],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[3*i+1],elevation[i],batchTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[3*i+2],range[i],batchTol);
+    }
+
+    //class conversion of one pair
+    AER pair = LLA(lla[3*10],lla[3*10+1],lla[3*10+2]).toAER(sensors[2].getOrigin(),270.0);
+    size_t index = 2*targetCount + 10;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(pair.getFirstCoordinate(),aer[3*index],batchTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(pair.getSecondCoordinate(),aer[3*index+1],batchTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(pair.getThirdCoordinate(),aer[3*index+2],piTol);
+}
+
+void batchConversionsTest::testVisibility() {
+    //targets around the sensor, on the ground and in the air, plus the sensor itself
+    const size_t targetCount = 1000;
+    LocalFrame sensor(_latitude,_longitude,_altitude,_heading);
+    std::vector<double> lla(3*targetCount), ecf(3*targetCount), aer(3*targetCount);
+    for (size_t t = 0; t < targetCount; t++) {
+        lla[3*t] = _latitude + fmod(t*0.731,40.0) - 20.0;
+        lla[3*t+1] = _longitude + fmod(t*1.377,40.0) - 20.0;
+        lla[3*t+2] = fmod(t*9111.0,900000.0);
+    }
+    llaToECF(targetCount,&lla[0],&ecf[0]);
+    ECF origin = sensor.getOriginECF();
+    ecf[3*7] = origin.getFirstCoordinate();
+    ecf[3*7+1] = origin.getSecondCoordinate();
+    ecf[3*7+2] = origin.getThirdCoordinate();
+    ecfToAER(targetCount,&ecf[0],&aer[0],sensor);
+
+    const double sectors[4] = {5.0, 20.0, -1.0, 45.0};
+    const double uniform[1] = {0.0};
+    const double maxRange = 2.0e6;
+    std::vector<double> x(targetCount), y(targetCount), z(targetCount);
+    for (size_t t = 0; t < targetCount; t++) {
+        x[t] = ecf[3*t];
+        y[t] = ecf[3*t+1];
+        z[t] = ecf[3*t+2];
+    }
+
+    simdLevel saved = getSimdLevel();
+    for (int level = SIMD_NONE; level <= SIMD_AVX512; level++) {
+        setSimdLevel((simdLevel)level);
+        for (int mask = 0; mask < 2; mask++) {
+            size_t sectorCount = (mask == 0) ? 1 : 4;
+            const double *elevations = (mask == 0) ? uniform : sectors;
+            std::vector<uint64_t> interleaved((targetCount+63)/64, ~(uint64_t) 0), separate((targetCount+63)/64);
+            size_t count = (mask == 0) ? ecfVisibility(targetCount,&ecf[0],sensor,0.0,maxRange,&interleaved[0]) :
+                    ecfVisibility(targetCount,&ecf[0],sensor,sectorCount,elevations,maxRange,&interleaved[0]);
+            CPPUNIT_ASSERT_EQUAL(count,ecfVisibility(targetCount,constCoordinateArray(&x[0],&y[0],&z[0]),sensor,
+                    sectorCount,elevations,maxRange,&separate[0]));
+            CPPUNIT_ASSERT(interleaved == separate);
+            CPPUNIT_ASSERT_EQUAL((uint64_t) 0,interleaved.back() >> (targetCount % 64)); //no bits past the last target
+
+            size_t visible = 0;
+            for (size_t t = 0; t < targetCount; t++) {
+                bool bit = (interleaved[t/64] >> (t%64)) & 1;
+                double azimuth = (aer[3*t] < 0) ? aer[3*t] + 360.0 : aer[3*t];
+                size_t sector = std::min((size_t) (azimuth*sectorCount/360.0),sectorCount-1);
+                double edge = fmod(azimuth,360.0/sectorCount);
+                visible += bit;
+                if (fabs(aer[3*t+1] - elevations[sector]) < visibilityTol || fabs(aer[3*t+2] - maxRange) < batchTol ||
+                        (sectorCount > 1 && std::min(edge,360.0/sectorCount - edge) < visibilityTol)) {
+                    continue;
+                }
+                CPPUNIT_ASSERT_EQUAL(aer[3*t+2] <= maxRange && aer[3*t+1] >= elevations[sector],bit);
+            }
+            CPPUNIT_ASSERT_EQUAL(visible,count);
+            CPPUNIT_ASSERT(count > 0 && count < targetCount);
+        }
+    }
+    setSimdLevel(saved);
+
+    //the sensor sees itself at zero elevation
+    std::vector<uint64_t> bits(1);
+    CPPUNIT_ASSERT_EQUAL((size_t) 1,ecfVisibility(1,&ecf[3*7],sensor,0.0,1.0,&bits[0]));
+    CPPUNIT_ASSERT_EQUAL((size_t) 0,ecfVisibility(1,&ecf[3*7],sensor,1.0,1.0,&bits[0]));
+    CPPUNIT_ASSERT_THROW(ecfVisibility(1,&ecf[0],sensor,0,sectors,maxRange,&bits[0]),std::runtime_error);
+}
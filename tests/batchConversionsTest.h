@@ -0,0 +1,89 @@
+/**
+ * @brief Batch conversion tester definition.
+ * @file batchConversionsTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the batch conversions against the coordinate
+ * systems class conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef BATCHCONVERSIONSTEST_H
+#define	BATCHCONVERSIONSTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#define batchTol 1.0e-6 //tolerance for matching the class conversions (meters, degrees)
+#define geodeticTol 1.0 //tolerance for matching ECF::toLLA, which stops at latTol (meters)
+#define piTol 1.0e-4 //batch geodetic kernels use a full precision PI, the classes the 12 digit macro (meters)
+#define closedFormTol 1.0e-6 //tolerance for closed-form ECF to LLA round trips (meters)
+#define visibilityTol 1.0e-9 //targets this close to a mask elevation or sector edge (degrees) may fall either side
+#define batchCount 5 //number of points in each test batch
+
+class batchConversionsTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(batchConversionsTest);
+
+    CPPUNIT_TEST(testCoordinateArray);
+    CPPUNIT_TEST(testECFToLLA);
+    CPPUNIT_TEST(testSimdLevel);
+    CPPUNIT_TEST(testClosedFormAccuracy);
+    CPPUNIT_TEST(testClosedFormCentre);
+    CPPUNIT_TEST(testLLAToECF);
+    CPPUNIT_TEST(testLLAToECFSimdLevels);
+    CPPUNIT_TEST(testECFToENU);
+    CPPUNIT_TEST(testENUToECF);
+    CPPUNIT_TEST(testENUToDCA);
+    CPPUNIT_TEST(testDCAToENU);
+    CPPUNIT_TEST(testDCAToAER);
+    CPPUNIT_TEST(testAERToDCA);
+    CPPUNIT_TEST(testECFToAER);
+    CPPUNIT_TEST(testLLAToAER);
+    CPPUNIT_TEST(testAERToLLA);
+    CPPUNIT_TEST(testComposedRoundTrips);
+    CPPUNIT_TEST(testFusedSimdLevels);
+    CPPUNIT_TEST(testSensorFrameSimdLevels);
+    CPPUNIT_TEST(testInPlace);
+    CPPUNIT_TEST(testLookAngleMatrix);
+    CPPUNIT_TEST(testVisibility);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    batchConversionsTest();
+    virtual ~batchConversionsTest();
+    void setUp();
+    void tearDown();
+
+private:
+    double _latitude, _longitude, _altitude;
+    double _heading;
+    double _ecf[batchCount][3];
+    double _lla[batchCount][3];
+    double _local[batchCount][3];
+    void testCoordinateArray();
+    void testECFToLLA();
+    void testSimdLevel();
+    void testClosedFormAccuracy();
+    void testClosedFormCentre();
+    void testLLAToECF();
+    void testLLAToECFSimdLevels();
+    void testECFToENU();
+    void testENUToECF();
+    void testENUToDCA();
+    void testDCAToENU();
+    void testDCAToAER();
+    void testAERToDCA();
+    void testECFToAER();
+    void testLLAToAER();
+    void testAERToLLA();
+    void testComposedRoundTrips();
+    void testFusedSimdLevels();
+    void testSensorFrameSimdLevels();
+    void testInPlace();
+    void testLookAngleMatrix();
+    void testVisibility();
+};
+
+#endif	/* BATCHCONVERSIONSTEST_H */
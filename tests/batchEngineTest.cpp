@@ -0,0 +1,146 @@
+/**
+ * @brief Parallel batch engine tester implementation.
+ * @file batchEngineTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the parallel batch engine against the serial
+ * batch conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include <atomic>
+#include <stdexcept>
+#include "batchEngineTest.h"
+#include "include/batchEngine.h"
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(batchEngineTest);
+
+batchEngineTest::batchEngineTest() {
+}
+
+batchEngineTest::~batchEngineTest() {
+}
+
+void batchEngineTest::setUp() {
+    std::vector<double> lla(3*engineCount);
+    for (int i = 0; i < engineCount; i++) {
+        lla[3*i] = fmod(i*0.731,180.0)-90.0;
+        lla[3*i+1] = fmod(i*1.377,360.0)-180.0;
+        lla[3*i+2] = fmod(i*91.0,20000.0);
+    }
+    _ecf.resize(3*engineCount);
+    llaToECF(engineCount,&lla[0],&_ecf[0]);
+    _latitude = 10.0;
+    _longitude = 20.0;
+    _altitude = 30.0;
+    _heading = 55.5;
+}
+
+void batchEngineTest::tearDown() {
+}
+
+void batchEngineTest::testThreadCount() {
+    BatchEngine single(1);
+    BatchEngine capped(3,100);
+    BatchEngine automatic;
+
+    CPPUNIT_ASSERT_EQUAL(1u,single.getThreadCount());
+    CPPUNIT_ASSERT_EQUAL(3u,capped.getThreadCount());
+    CPPUNIT_ASSERT_EQUAL((size_t)100,capped.getChunkSize());
+    CPPUNIT_ASSERT(automatic.getThreadCount() >= 1);
+}
+
+void batchEngineTest::testCoverage() {
+    BatchEngine engine(4,7);
+    std::vector<std::atomic<int> > visits(engineCount);
+
+    for (int pass = 0; pass < 3; pass++) {
+        for (int i = 0; i < engineCount; i++) {
+            visits[i] = 0;
+        }
+        engine.run(engineCount,[&](size_t begin, size_t end){
+            CPPUNIT_ASSERT(end - begin <= 7);
+            for (size_t i = begin; i < end; i++) {
+                visits[i]++;
+            }
+        });
+        for (int i = 0; i < engineCount; i++) {
+            CPPUNIT_ASSERT_EQUAL(1,(int)visits[i]);
+        }
+    }
+    engine.run(0,[&](size_t, size_t){
+        CPPUNIT_FAIL("empty batch ran a task");
+    });
+}
+
+void batchEngineTest::testDeterministic() {
+    std::vector<double> serial(3*engineCount), parallel(3*engineCount);
+    unsigned threads[4] = {1, 2, 5, 8};
+    size_t chunks[3] = {1, 64, 1000};
+
+    ecfToLLA(engineCount,&_ecf[0],&serial[0]);
+    for (int t = 0; t < 4; t++) {
+        for (int c = 0; c < 3; c++) {
+            BatchEngine engine(threads[t],chunks[c]);
+            engine.run(engineCount,&_ecf[0],&parallel[0],ecfToLLA);
+            for (int i = 0; i < 3*engineCount; i++) {
+                CPPUNIT_ASSERT_EQUAL(serial[i],parallel[i]);
+            }
+        }
+    }
+}
+
+void batchEngineTest::testFrameConversions() {
+    BatchEngine engine(4,333);
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    std::vector<double> serial(3*engineCount), parallel(3*engineCount);
+    std::vector<double> first(engineCount), second(engineCount), third(engineCount);
+    coordinateArray soa(&first[0],&second[0],&third[0]);
+
+    ecfToAER(engineCount,&_ecf[0],&serial[0],frame);
+    engine.run(engineCount,&_ecf[0],soa,ecfToAER,frame);
+    for (int i = 0; i < engineCount; i++) {
+        CPPUNIT_ASSERT_EQUAL(serial[3*i],first[i]);
+        CPPUNIT_ASSERT_EQUAL(serial[3*i+1],second[i]);
+        CPPUNIT_ASSERT_EQUAL(serial[3*i+2],third[i]);
+    }
+
+    aerToENU(engineCount,soa,&serial[0],_heading);
+    engine.run(engineCount,soa,&parallel[0],aerToENU,_heading);
+    for (int i = 0; i < 3*engineCount; i++) {
+        CPPUNIT_ASSERT_EQUAL(serial[i],parallel[i]);
+    }
+}
+
+void batchEngineTest::testInPlace() {
+    BatchEngine engine(3,50);
+    std::vector<double> expected(3*engineCount), points(_ecf);
+
+    ecfToLLA(engineCount,&_ecf[0],&expected[0]);
+    engine.run(engineCount,&points[0],&points[0],ecfToLLA);
+    for (int i = 0; i < 3*engineCount; i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],points[i]);
+    }
+}
+
+void batchEngineTest::testException() {
+    BatchEngine engine(4,10);
+    std::atomic<int> visited(0);
+
+    CPPUNIT_ASSERT_THROW(engine.run(engineCount,[&](size_t begin, size_t){
+        if (begin == 5000) {
+            throw std::runtime_error("chunk failed");
+        }
+    }),std::runtime_error);
+
+    //the engine stays usable after a failed run
+    engine.run(engineCount,[&](size_t begin, size_t end){
+        visited += (int)(end - begin);
+    });
+    CPPUNIT_ASSERT_EQUAL(engineCount,(int)visited);
+}
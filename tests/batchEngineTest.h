@@ -0,0 +1,51 @@
+/**
+ * @brief Parallel batch engine tester definition.
+ * @file batchEngineTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the parallel batch engine against the serial
+ * batch conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef BATCHENGINETEST_H
+#define	BATCHENGINETEST_H
+
+#include <vector>
+#include <cppunit/extensions/HelperMacros.h>
+
+#define engineCount 10007 //number of points in each test batch, prime so the last chunk is partial
+
+class batchEngineTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(batchEngineTest);
+
+    CPPUNIT_TEST(testThreadCount);
+    CPPUNIT_TEST(testCoverage);
+    CPPUNIT_TEST(testDeterministic);
+    CPPUNIT_TEST(testFrameConversions);
+    CPPUNIT_TEST(testInPlace);
+    CPPUNIT_TEST(testException);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    batchEngineTest();
+    virtual ~batchEngineTest();
+    void setUp();
+    void tearDown();
+
+private:
+    std::vector<double> _ecf;
+    double _latitude, _longitude, _altitude;
+    double _heading;
+    void testThreadCount();
+    void testCoverage();
+    void testDeterministic();
+    void testFrameConversions();
+    void testInPlace();
+    void testException();
+};
+
+#endif	/* BATCHENGINETEST_H */
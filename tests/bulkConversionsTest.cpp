@@ -0,0 +1,200 @@
+/**
+ * @brief Memory-mapped bulk conversions tester implementation.
+ * @file bulkConversionsTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the bulk conversions of point files against the
+ * batch conversions, in place and into a new file, serially and on a
+ * BatchEngine, and their error handling.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdexcept>
+#include "bulkConversionsTest.h"
+#include "include/bulkConversions.h"
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(bulkConversionsTest);
+
+static std::string temporaryFile(){
+    char name[] = "/tmp/bulkConversionsTestXXXXXX";
+    int descriptor = mkstemp(name);
+    if (descriptor >= 0) {
+        close(descriptor);
+    }
+    return name;
+}
+
+static void writePoints(const std::string &path, const std::vector<double> &points){
+    FILE *file = fopen(path.c_str(),"wb");
+    fwrite(points.data(),sizeof(double),points.size(),file);
+    fclose(file);
+}
+
+static void failingConversion(size_t, constCoordinateArray, coordinateArray){
+    throw std::runtime_error("conversion failed");
+}
+
+static std::vector<double> readPoints(const std::string &path){
+    std::vector<double> points;
+    double value;
+    FILE *file = fopen(path.c_str(),"rb");
+    while (fread(&value,sizeof(double),1,file) == 1) {
+        points.push_back(value);
+    }
+    fclose(file);
+    return points;
+}
+
+bulkConversionsTest::bulkConversionsTest() {
+}
+
+bulkConversionsTest::~bulkConversionsTest() {
+}
+
+void bulkConversionsTest::setUp() {
+    std::vector<double> lla(3*bulkCount);
+    for (int i = 0; i < bulkCount; i++) {
+        lla[3*i] = fmod(i*0.731,180.0)-90.0;
+        lla[3*i+1] = fmod(i*1.377,360.0)-180.0;
+        lla[3*i+2] = fmod(i*91.0,20000.0);
+    }
+    _ecf.resize(3*bulkCount);
+    llaToECF(bulkCount,&lla[0],&_ecf[0]);
+    _input = temporaryFile();
+    _output = temporaryFile();
+    writePoints(_input,_ecf);
+}
+
+void bulkConversionsTest::tearDown() {
+    remove(_input.c_str());
+    remove(_output.c_str());
+}
+
+void bulkConversionsTest::testToFile() {
+    std::vector<double> expected(3*bulkCount);
+    ecfToLLA(bulkCount,&_ecf[0],&expected[0]);
+    writePoints(_output,std::vector<double>(6*bulkCount,0.0)); //an existing longer output is cut to size
+
+    CPPUNIT_ASSERT_EQUAL((size_t)bulkCount,convertFile(_input,_output,ecfToLLA,NULL,1000));
+    std::vector<double> lla = readPoints(_output);
+    CPPUNIT_ASSERT_EQUAL(expected.size(),lla.size());
+    for (size_t i = 0; i < lla.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],lla[i]);
+    }
+    //the input is untouched
+    std::vector<double> ecf = readPoints(_input);
+    for (size_t i = 0; i < ecf.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(_ecf[i],ecf[i]);
+    }
+}
+
+void bulkConversionsTest::testInPlace() {
+    std::vector<double> expected(3*bulkCount);
+    ecfToLLA(bulkCount,&_ecf[0],&expected[0]);
+
+    CPPUNIT_ASSERT_EQUAL((size_t)bulkCount,convertFile(_input,ecfToLLA));
+    std::vector<double> lla = readPoints(_input);
+    CPPUNIT_ASSERT_EQUAL(expected.size(),lla.size());
+    for (size_t i = 0; i < lla.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],lla[i]);
+    }
+}
+
+void bulkConversionsTest::testSamePath() {
+    std::vector<double> expected(3*bulkCount);
+    std::string alias = _input + ".link";
+    ecfToLLA(bulkCount,&_ecf[0],&expected[0]);
+
+    //the output is the input: converted in place rather than truncated
+    CPPUNIT_ASSERT_EQUAL((size_t)bulkCount,convertFile(_input,_input,ecfToLLA));
+    std::vector<double> lla = readPoints(_input);
+    CPPUNIT_ASSERT_EQUAL(expected.size(),lla.size());
+    for (size_t i = 0; i < lla.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],lla[i]);
+    }
+
+    //same file under another name
+    writePoints(_input,_ecf);
+    CPPUNIT_ASSERT_EQUAL(0,link(_input.c_str(),alias.c_str()));
+    CPPUNIT_ASSERT_EQUAL((size_t)bulkCount,convertFile(_input,alias,ecfToLLA));
+    remove(alias.c_str());
+    lla = readPoints(_input);
+    CPPUNIT_ASSERT_EQUAL(expected.size(),lla.size());
+    for (size_t i = 0; i < lla.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],lla[i]);
+    }
+}
+
+void bulkConversionsTest::testFrameConversions() {
+    LocalFrame frame(10.0,20.0,30.0,55.5);
+    std::vector<double> aer(3*bulkCount), dca(3*bulkCount);
+    ecfToAER(bulkCount,&_ecf[0],&aer[0],frame);
+    aerToDCA(bulkCount,&aer[0],&dca[0]);
+
+    convertFile(_input,_output,ecfToAER,frame,NULL,333);
+    std::vector<double> result = readPoints(_output);
+    for (size_t i = 0; i < result.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(aer[i],result[i]);
+    }
+
+    std::vector<double> expected(3*bulkCount);
+    dcaToENU(bulkCount,&dca[0],&expected[0],55.5);
+    writePoints(_input,dca);
+    convertFile(_input,dcaToENU,55.5);
+    result = readPoints(_input);
+    for (size_t i = 0; i < result.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],result[i]);
+    }
+}
+
+void bulkConversionsTest::testEngine() {
+    BatchEngine engine(4,512);
+    LocalFrame frame(10.0,20.0,30.0,55.5);
+    std::vector<double> expected(3*bulkCount);
+    ecfToENU(bulkCount,&_ecf[0],&expected[0],frame);
+
+    convertFile(_input,_output,ecfToENU,frame,&engine,4096);
+    std::vector<double> enu = readPoints(_output);
+    for (size_t i = 0; i < enu.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],enu[i]);
+    }
+
+    ecfToLLA(bulkCount,&_ecf[0],&expected[0]);
+    convertFile(_input,ecfToLLA,&engine);
+    std::vector<double> lla = readPoints(_input);
+    for (size_t i = 0; i < lla.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(expected[i],lla[i]);
+    }
+}
+
+void bulkConversionsTest::testEmptyFile() {
+    writePoints(_input,std::vector<double>());
+    CPPUNIT_ASSERT_EQUAL((size_t)0,convertFile(_input,_output,ecfToLLA));
+    CPPUNIT_ASSERT(readPoints(_output).empty());
+    CPPUNIT_ASSERT_EQUAL((size_t)0,convertFile(_input,ecfToLLA));
+}
+
+void bulkConversionsTest::testErrors() {
+    std::vector<double> partial(4, 1.0); //one and a third points
+    CPPUNIT_ASSERT_THROW(convertFile(_input + ".missing",_output,ecfToLLA),std::runtime_error);
+    CPPUNIT_ASSERT_THROW(convertFile(_input + ".missing",ecfToLLA),std::runtime_error);
+    writePoints(_input,partial);
+    CPPUNIT_ASSERT_THROW(convertFile(_input,_output,ecfToLLA),std::runtime_error);
+    CPPUNIT_ASSERT_THROW(convertFile(_input,ecfToLLA),std::runtime_error);
+
+    //a failed conversion removes an output it created and keeps an existing one
+    std::string created = _output + ".new";
+    writePoints(_input,_ecf);
+    CPPUNIT_ASSERT_THROW(convertFile(_input,created,failingConversion),std::runtime_error);
+    CPPUNIT_ASSERT(access(created.c_str(),F_OK) != 0);
+    CPPUNIT_ASSERT_THROW(convertFile(_input,_output,failingConversion),std::runtime_error);
+    CPPUNIT_ASSERT_EQUAL(0,access(_output.c_str(),F_OK));
+}
@@ -0,0 +1,54 @@
+/**
+ * @brief Memory-mapped bulk conversions tester definition.
+ * @file bulkConversionsTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the bulk conversions of point files against the
+ * batch conversions, in place and into a new file, serially and on a
+ * BatchEngine, and their error handling.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef BULKCONVERSIONSTEST_H
+#define	BULKCONVERSIONSTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <string>
+#include <vector>
+
+#define bulkCount 10007 //points in the test file, not a multiple of the chunk size
+
+class bulkConversionsTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(bulkConversionsTest);
+
+    CPPUNIT_TEST(testToFile);
+    CPPUNIT_TEST(testInPlace);
+    CPPUNIT_TEST(testSamePath);
+    CPPUNIT_TEST(testFrameConversions);
+    CPPUNIT_TEST(testEngine);
+    CPPUNIT_TEST(testEmptyFile);
+    CPPUNIT_TEST(testErrors);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    bulkConversionsTest();
+    virtual ~bulkConversionsTest();
+    void setUp();
+    void tearDown();
+
+private:
+    std::vector<double> _ecf;
+    std::string _input, _output;
+    void testToFile();
+    void testInPlace();
+    void testSamePath();
+    void testFrameConversions();
+    void testEngine();
+    void testEmptyFile();
+    void testErrors();
+};
+
+#endif	/* BULKCONVERSIONSTEST_H */
@@ -0,0 +1,228 @@
+/**
+ * @brief Scalar-type templated conversion formulas tester implementation.
+ * @file conversionKernelsTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the float, double and long double
+ * instantiations of the conversion formulas against the coordinate systems
+ * classes and against each other.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include "conversionKernelsTest.h"
+#include "include/coordinateSystems.h"
+#include "include/conversionKernels.h"
+
+using namespace coordinateSystems;
+using namespace coordinateSystems::kernels;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(conversionKernelsTest);
+
+conversionKernelsTest::conversionKernelsTest() {
+}
+
+conversionKernelsTest::~conversionKernelsTest() {
+}
+
+void conversionKernelsTest::setUp() {
+    _latitude = 10.0;
+    _longitude = 20.0;
+    _altitude = 30.0;
+    _heading = 55.5;
+    _first = 1111.11;
+    _second = 222.22;
+    _third = 333.33;
+}
+
+void conversionKernelsTest::tearDown() {
+}
+
+void conversionKernelsTest::testSinCosDegrees() {
+    double angles[] = {-720.0, -270.0, -180.0, -135.0, -90.0, -30.0, 0.0, 45.0, 90.0, 135.0, 180.0, 270.0, 405.0};
+    for (int i = 0; i < 13; i++) {
+        long double radians = angles[i]*3.14159265358979323846264338327950288L/180.0L;
+        float sineF, cosineF;
+        double sineD, cosineD;
+        long double sineL, cosineL;
+        sincosDegrees((float)angles[i],sineF,cosineF);
+        sincosDegrees(angles[i],sineD,cosineD);
+        sincosDegrees((long double)angles[i],sineL,cosineL);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)sinl(radians),sineF,1e-7);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)cosl(radians),cosineF,1e-7);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)sinl(radians),sineD,1e-15);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)cosl(radians),cosineD,1e-15);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)sinl(radians),(double)sineL,1e-18);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)cosl(radians),(double)cosineL,1e-18);
+    }
+
+    //multiples of 90 degrees are exact in every type
+    float sineF, cosineF;
+    long double sineL, cosineL;
+    sincosDegrees(-90.0f,sineF,cosineF);
+    CPPUNIT_ASSERT_EQUAL(-1.0f,sineF);
+    CPPUNIT_ASSERT_EQUAL(0.0f,cosineF);
+    sincosDegrees(180.0L,sineL,cosineL);
+    CPPUNIT_ASSERT(sineL == 0.0L);
+    CPPUNIT_ASSERT(cosineL == -1.0L);
+}
+
+void conversionKernelsTest::testGeodetic() {
+    double x, y, z, latitude, longitude, altitude;
+    ECF expected = LLA(_latitude,_longitude,_altitude).toECF();
+
+    llaToECFSinCos(_latitude,_longitude,_altitude,earthCentered::a,earthCentered::e2,x,y,z);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),x,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),y,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),z,doubleTol);
+
+    ecfToLLAClosedForm(x,y,z,earthCentered::a,earthCentered::e2,latitude,longitude,altitude);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_latitude,latitude,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_longitude,longitude,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_altitude,altitude,doubleTol);
+
+    float xF, yF, zF, latitudeF, longitudeF, altitudeF;
+    llaToECFSinCos((float)_latitude,(float)_longitude,(float)_altitude,earthCentered::a,earthCentered::e2,xF,yF,zF);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(x,xF,floatLengthTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(y,yF,floatLengthTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(z,zF,floatLengthTol);
+
+    ecfToLLAClosedForm((float)x,(float)y,(float)z,earthCentered::a,earthCentered::e2,latitudeF,longitudeF,altitudeF);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_latitude,latitudeF,floatAngleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_longitude,longitudeF,floatAngleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_altitude,altitudeF,floatLengthTol);
+}
+
+void conversionKernelsTest::testGeodeticPrecision() {
+    //double agrees with the long double reference to the documented bounds
+    for (int i = -9; i <= 9; i++) {
+        double latitude = i*9.9 + 0.123;
+        double longitude = i*19.0 + 0.456;
+        double altitude = (i + 10)*2.0e6;
+        long double xL, yL, zL, latitudeL, longitudeL, altitudeL;
+        double x, y, z, latitudeD, longitudeD, altitudeD;
+
+        llaToECFSinCos<long double>(latitude,longitude,altitude,earthCentered::a,earthCentered::e2,xL,yL,zL);
+        llaToECFSinCos(latitude,longitude,altitude,earthCentered::a,earthCentered::e2,x,y,z);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)xL,x,2e-8);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)yL,y,2e-8);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)zL,z,2e-8);
+
+        ecfToLLAClosedForm(xL,yL,zL,earthCentered::a,earthCentered::e2,latitudeL,longitudeL,altitudeL);
+        ecfToLLAClosedForm((double)xL,(double)yL,(double)zL,earthCentered::a,earthCentered::e2,latitudeD,longitudeD,altitudeD);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)latitudeL,latitudeD,1e-13);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)longitudeL,longitudeD,1e-13);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((double)altitudeL,altitudeD,2e-8);
+
+        //the long double round trip is tighter than double
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(latitude,(double)latitudeL,1e-14);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(altitude,(double)altitudeL,1e-10);
+    }
+}
+
+void conversionKernelsTest::testGeodeticCentre() {
+    //on the axis and in the equatorial plane near the centre the closed form
+    //agrees with the iterative solver, and nowhere near it is it NaN
+    const double points[][3] = {{0.0,0.0,0.0}, {1.0,0.0,0.0}, {1000.0,1000.0,0.0},
+            {0.0,0.0,1.0}, {0.0,0.0,-1.0}, {0.0,0.0,30000.0}, {-20000.0,5000.0,0.0},
+            {0.0,0.0,6356000.0}};
+    for (int i = 0; i < 8; i++) {
+        double x = points[i][0], y = points[i][1], z = points[i][2];
+        double latitude, longitude, altitude, latitudeI, longitudeI, altitudeI;
+        float latitudeF, longitudeF, altitudeF;
+
+        ECF::toLLA(x,y,z,latitudeI,longitudeI,altitudeI,GEODETIC_ITERATIVE);
+        ecfToLLAClosedForm(x,y,z,earthCentered::a,earthCentered::e2,latitude,longitude,altitude);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(latitudeI,latitude,doubleTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(longitudeI,longitude,doubleTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(altitudeI,altitude,1e-6);
+
+        ECF::toLLA(x,y,z,latitude,longitude,altitude,GEODETIC_CLOSED_FORM);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(latitudeI,latitude,doubleTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(altitudeI,altitude,1e-6);
+
+        ecfToLLAClosedForm((float)x,(float)y,(float)z,earthCentered::a,earthCentered::e2,latitudeF,longitudeF,altitudeF);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(latitudeI,latitudeF,floatAngleTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(altitudeI,altitudeF,floatLengthTol);
+    }
+
+    //off the axis and the plane the result is finite and consistent
+    for (int i = -5; i <= 5; i++) {
+        double x = 7000.0*i + 3.0, y = -2000.0, z = 4000.0*i - 1.0;
+        double latitude, longitude, altitude;
+        ecfToLLAClosedForm(x,y,z,earthCentered::a,earthCentered::e2,latitude,longitude,altitude);
+        CPPUNIT_ASSERT(fabs(latitude) <= 90.0);
+        CPPUNIT_ASSERT(altitude < -earthCentered::a*sqrt(1.0-earthCentered::e2) + 50000.0);
+        CPPUNIT_ASSERT(altitude > -earthCentered::a);
+    }
+}
+
+void conversionKernelsTest::testPolar() {
+    double azimuth, elevation, range, downRange, crossRange, above;
+    AER expected = DCA(_first,_second,_third).toAER();
+
+    dcaToAERPolar(_first,_second,_third,azimuth,elevation,range);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),azimuth,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),elevation,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),range,doubleTol);
+
+    aerToDCAPolar(azimuth,elevation,range,downRange,crossRange,above);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_first,downRange,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_second,crossRange,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_third,above,doubleTol);
+
+    float azimuthF, elevationF, rangeF;
+    dcaToAERPolar((float)_first,(float)_second,(float)_third,azimuthF,elevationF,rangeF);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(azimuth,azimuthF,floatAngleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(elevation,elevationF,floatAngleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(range,rangeF,floatLengthTol);
+
+    long double azimuthL, elevationL, rangeL;
+    dcaToAERPolar<long double>(_first,_second,_third,azimuthL,elevationL,rangeL);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(azimuth,(double)azimuthL,1e-13);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(elevation,(double)elevationL,1e-13);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(range,(double)rangeL,1e-9);
+}
+
+void conversionKernelsTest::testLocal() {
+    ECF point = ENU(_first,_second,_third,_latitude,_longitude,_altitude).toECF();
+    ECF originECF = LLA(_latitude,_longitude,_altitude).toECF();
+    double origin[3] = {originECF.getFirstCoordinate(), originECF.getSecondCoordinate(), originECF.getThirdCoordinate()};
+    double rotation[3][3];
+    double east, north, up, x, y, z;
+
+    enuRotation(_latitude,_longitude,rotation);
+    rotateToLocal(point.getFirstCoordinate(),point.getSecondCoordinate(),point.getThirdCoordinate(),origin,rotation,east,north,up);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_first,east,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_second,north,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_third,up,doubleTol);
+
+    rotateFromLocal(east,north,up,origin,rotation,x,y,z);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(point.getFirstCoordinate(),x,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(point.getSecondCoordinate(),y,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(point.getThirdCoordinate(),z,doubleTol);
+
+    double downRange, crossRange, above;
+    DCA expected = ENU(_first,_second,_third).toDCA(_heading);
+    enuToDCARotation(_first,_second,_third,_heading,downRange,crossRange,above);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),downRange,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),crossRange,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),above,doubleTol);
+
+    dcaToENURotation(downRange,crossRange,above,_heading,east,north,up);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_first,east,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_second,north,doubleTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_third,up,doubleTol);
+
+    //float frame applied to float points
+    float originF[3] = {(float)origin[0], (float)origin[1], (float)origin[2]};
+    float rotationF[3][3];
+    float eastF, northF, upF;
+    enuRotation((float)_latitude,(float)_longitude,rotationF);
+    rotateToLocal((float)point.getFirstCoordinate(),(float)point.getSecondCoordinate(),(float)point.getThirdCoordinate(),originF,rotationF,eastF,northF,upF);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_first,eastF,floatLengthTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_second,northF,floatLengthTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_third,upF,floatLengthTol);
+}
@@ -0,0 +1,53 @@
+/**
+ * @brief Scalar-type templated conversion formulas tester definition.
+ * @file conversionKernelsTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the float, double and long double
+ * instantiations of the conversion formulas against the coordinate systems
+ * classes and against each other.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef CONVERSIONKERNELSTEST_H
+#define	CONVERSIONKERNELSTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#define doubleTol 1.0e-6 //tolerance for matching the class conversions (meters, degrees)
+#define floatAngleTol 3.0e-5 //documented float angle bound (degrees)
+#define floatLengthTol 2.0 //documented float length bound near the surface (meters)
+
+class conversionKernelsTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(conversionKernelsTest);
+
+    CPPUNIT_TEST(testSinCosDegrees);
+    CPPUNIT_TEST(testGeodetic);
+    CPPUNIT_TEST(testGeodeticPrecision);
+    CPPUNIT_TEST(testGeodeticCentre);
+    CPPUNIT_TEST(testPolar);
+    CPPUNIT_TEST(testLocal);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    conversionKernelsTest();
+    virtual ~conversionKernelsTest();
+    void setUp();
+    void tearDown();
+
+private:
+    double _latitude, _longitude, _altitude;
+    double _heading;
+    double _first, _second, _third;
+    void testSinCosDegrees();
+    void testGeodetic();
+    void testGeodeticPrecision();
+    void testGeodeticCentre();
+    void testPolar();
+    void testLocal();
+};
+
+#endif	/* CONVERSIONKERNELSTEST_H */
@@ -483,6 +483,43 @@ void coordinateSystemsTest::testECFToLLAZeroX() {
     CPPUNIT_ASSERT_EQUAL(300.0,result1.getThirdCoordinate());
 }
 
+void coordinateSystemsTest::testECFToLLASolvers() {
+    geodeticSolver solvers[] = {GEODETIC_ITERATIVE, GEODETIC_FIXED, GEODETIC_MILLIMETRE, GEODETIC_CLOSED_FORM};
+    double b = sqrt(pow(sma,2)*(1-ecc2));
+    double latitude, longitude, altitude;
+
+    for (int i = 0; i < 4; i++) {
+        ECF ECF1(_X, _Y, _Z);
+        ECF result = ECF1.toLLA(solvers[i]).toECF();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_X,result.getFirstCoordinate(),tol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_Y,result.getSecondCoordinate(),tol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(_Z,result.getThirdCoordinate(),tol);
+
+        ECF::toLLA(0.0,0.0,-b-300.0,latitude,longitude,altitude,solvers[i]);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(-90.0,latitude,tol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(300.0,altitude,tol);
+    }
+
+    //a geostationary altitude needs more than one fixed iteration for millimetres
+    LLA target(45.0,10.0,35786000.0);
+    ECF geo = target.toECF();
+    LLA result1 = geo.toLLA(GEODETIC_FIXED);
+    LLA result2 = geo.toLLA(GEODETIC_FIXED,2);
+    LLA result3 = geo.toLLA(GEODETIC_MILLIMETRE);
+    LLA result4 = geo.toLLA(GEODETIC_CLOSED_FORM);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(45.0,result1.getFirstCoordinate(),1e-6);
+    CPPUNIT_ASSERT(fabs(result1.getFirstCoordinate()-45.0) > 1e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(45.0,result2.getFirstCoordinate(),1e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(45.0,result3.getFirstCoordinate(),1e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(45.0,result4.getFirstCoordinate(),1e-9);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(35786000.0,result3.getThirdCoordinate(),tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(35786000.0,result4.getThirdCoordinate(),tol);
+
+    //the iteration count is at least one
+    LLA result5 = geo.toLLA(GEODETIC_FIXED,0);
+    CPPUNIT_ASSERT_EQUAL(result1.getFirstCoordinate(),result5.getFirstCoordinate());
+}
+
 void coordinateSystemsTest::testENU() {
     LLA _origin(_latitude,_longitude,_altitude);
     ENU ENU1(_origin);
@@ -48,6 +48,7 @@ class coordinateSystemsTest : public CPPUNIT_NS::TestFixture {
     CPPUNIT_TEST(testECFToLLA);
     CPPUNIT_TEST(testECFToLLAPolar);
     CPPUNIT_TEST(testECFToLLAZeroX);
+    CPPUNIT_TEST(testECFToLLASolvers);
     CPPUNIT_TEST(testENU);
     CPPUNIT_TEST(testENUToAER);
     CPPUNIT_TEST(testENUToDCA);
@@ -105,6 +106,7 @@ private:
     void testECFToLLA();
     void testECFToLLAPolar();
     void testECFToLLAZeroX();
+    void testECFToLLASolvers();
     void testENU();
     void testENUToAER();
     void testENUToDCA();
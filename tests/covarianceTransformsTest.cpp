@@ -0,0 +1,199 @@
+/**
+ * @brief Covariance transformation tester implementation.
+ * @file covarianceTransformsTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the analytic Jacobians and the batch covariance
+ * transforms against finite differences and against each other.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include "covarianceTransformsTest.h"
+#include "include/covarianceTransforms.h"
+
+#define jacobianTol 1e-6 //relative to the largest derivative
+#define covarianceTol 1e-9 //relative to the largest variance
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(covarianceTransformsTest);
+
+/*
+ * A symmetric positive definite covariance per point: meters squared, or
+ * degrees squared for angles when scale is small.
+ */
+static void makeCovariance(double scale, int seed, double *P){
+    double L[3][3] = {{1.0, 0.0, 0.0}, {0.3 + 0.1*seed, 2.0, 0.0}, {-0.2, 0.5 - 0.1*seed, 1.5}};
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            P[3*i+j] = scale*(L[i][0]*L[j][0] + L[i][1]*L[j][1] + L[i][2]*L[j][2]);
+        }
+    }
+}
+static void assertMatrixEqual(const double *expected, const double *actual, double tol){
+    double largest = 0.0;
+    for (int i = 0; i < 9; i++) {
+        largest = fmax(largest,fabs(expected[i]));
+    }
+    for (int i = 0; i < 9; i++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i],actual[i],tol*largest);
+    }
+}
+static void dcaToAER(const double in[3], double out[3]){
+    DCA::toAER(in[0],in[1],in[2],out[0],out[1],out[2]);
+}
+static void aerToDCA(const double in[3], double out[3]){
+    AER::toDCA(in[0],in[1],in[2],out[0],out[1],out[2]);
+}
+//central differences, column j holds the derivatives along input j
+static void numericJacobian(void (*f)(const double[3], double[3]), const double x[3], const double steps[3],
+        double J[3][3]){
+    for (int j = 0; j < 3; j++) {
+        double plus[3] = {x[0], x[1], x[2]}, minus[3] = {x[0], x[1], x[2]};
+        double high[3], low[3];
+        plus[j] += steps[j];
+        minus[j] -= steps[j];
+        f(plus,high);
+        f(minus,low);
+        for (int i = 0; i < 3; i++) {
+            J[i][j] = (high[i] - low[i])/(2*steps[j]);
+        }
+    }
+}
+
+covarianceTransformsTest::covarianceTransformsTest() {
+}
+
+covarianceTransformsTest::~covarianceTransformsTest() {
+}
+
+void covarianceTransformsTest::setUp() {
+}
+
+void covarianceTransformsTest::tearDown() {
+}
+
+void covarianceTransformsTest::testPolarJacobians() {
+    double points[4][3] = {{1000.0, 2000.0, 300.0}, {-5000.0, 100.0, -2000.0}, {20.0, -30000.0, 50000.0},
+        {100000.0, 1.0, 1.0}};
+    double steps[3] = {1e-3, 1e-3, 1e-3};
+    double angleSteps[3] = {1e-6, 1e-6, 1e-3};
+    for (int n = 0; n < 4; n++) {
+        double J[3][3], numeric[3][3], aer[3];
+        dcaToAERJacobian(points[n][0],points[n][1],points[n][2],J);
+        numericJacobian(dcaToAER,points[n],steps,numeric);
+        assertMatrixEqual(&numeric[0][0],&J[0][0],jacobianTol);
+
+        dcaToAER(points[n],aer);
+        aerToDCAJacobian(aer[0],aer[1],aer[2],J);
+        numericJacobian(aerToDCA,aer,angleSteps,numeric);
+        assertMatrixEqual(&numeric[0][0],&J[0][0],jacobianTol);
+    }
+}
+
+void covarianceTransformsTest::testECFJacobian() {
+    LocalFrame frame(38.0,-77.0,100.0,30.0);
+    ECFVec ecf = toVec3(LLA(38.5,-76.5,2000.0).toECF());
+    double J[3][3];
+    ecfToAERJacobian(ecf,frame,J);
+    for (int j = 0; j < 3; j++) {
+        ECFVec plus = ecf, minus = ecf;
+        double *plusCoordinate = (j == 0) ? &plus.first : (j == 1) ? &plus.second : &plus.third;
+        double *minusCoordinate = (j == 0) ? &minus.first : (j == 1) ? &minus.second : &minus.third;
+        *plusCoordinate += 0.01;
+        *minusCoordinate -= 0.01;
+        AERVec high = frame.toAER(plus), low = frame.toAER(minus);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((high.first - low.first)/0.02,J[0][j],1e-9);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((high.second - low.second)/0.02,J[1][j],1e-9);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((high.third - low.third)/0.02,J[2][j],1e-6);
+    }
+}
+
+void covarianceTransformsTest::testSingular() {
+    double J[3][3];
+    dcaToAERJacobian(0.0,0.0,0.0,J);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            CPPUNIT_ASSERT_EQUAL(0.0,J[i][j]);
+        }
+    }
+    //straight up: only the range row is defined
+    dcaToAERJacobian(0.0,0.0,1000.0,J);
+    CPPUNIT_ASSERT_EQUAL(0.0,J[0][0]);
+    CPPUNIT_ASSERT_EQUAL(0.0,J[1][2]);
+    CPPUNIT_ASSERT_EQUAL(1.0,J[2][2]);
+}
+
+void covarianceTransformsTest::testRotations() {
+    LocalFrame frame(38.0,-77.0,100.0,30.0);
+    double ecf[18], enu[18], dca[18], direct[18], back[18];
+    makeCovariance(100.0,0,ecf);
+    makeCovariance(4.0,1,ecf + 9);
+
+    ecfToENUCovariance(2,ecf,enu,frame);
+    enuToDCACovariance(2,enu,dca,frame);
+    ecfToDCACovariance(2,ecf,direct,frame);
+    for (int n = 0; n < 2; n++) {
+        assertMatrixEqual(direct + 9*n,dca + 9*n,covarianceTol);
+        //rotations keep the trace
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(ecf[9*n] + ecf[9*n+4] + ecf[9*n+8],enu[9*n] + enu[9*n+4] + enu[9*n+8],
+                covarianceTol*ecf[9*n+4]);
+    }
+
+    dcaToENUCovariance(2,dca,back,frame);
+    enuToECFCovariance(2,back,back,frame); //in place
+    for (int n = 0; n < 2; n++) {
+        assertMatrixEqual(ecf + 9*n,back + 9*n,covarianceTol);
+    }
+    dcaToECFCovariance(2,direct,direct,frame);
+    for (int n = 0; n < 2; n++) {
+        assertMatrixEqual(ecf + 9*n,direct + 9*n,covarianceTol);
+    }
+}
+
+void covarianceTransformsTest::testPolarCovariances() {
+    LocalFrame frame(38.0,-77.0,100.0,30.0);
+    double positions[6], dcaPositions[6], aerPositions[6];
+    double ecf[18], dca[18], aer[18], fused[18], back[18];
+    LLA targets[2] = {LLA(38.5,-76.5,2000.0), LLA(37.9,-77.2,12000.0)};
+    for (int n = 0; n < 2; n++) {
+        ECF target = targets[n].toECF();
+        positions[3*n] = target.getFirstCoordinate();
+        positions[3*n+1] = target.getSecondCoordinate();
+        positions[3*n+2] = target.getThirdCoordinate();
+        makeCovariance(25.0,n,ecf + 9*n);
+    }
+    ecfToDCA(2,positions,dcaPositions,frame);
+    ecfToAER(2,positions,aerPositions,frame);
+
+    //the fused transform matches the two-step one
+    ecfToDCACovariance(2,ecf,dca,frame);
+    dcaToAERCovariance(2,dcaPositions,dca,aer);
+    ecfToAERCovariance(2,positions,ecf,fused,frame);
+    for (int n = 0; n < 2; n++) {
+        assertMatrixEqual(aer + 9*n,fused + 9*n,covarianceTol);
+        //range variance is the variance along the line of sight
+        double J[3][3];
+        ecfToAERJacobian(ECFVec(positions[3*n],positions[3*n+1],positions[3*n+2]),frame,J);
+        double rangeVariance = 0.0;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                rangeVariance += J[2][i]*ecf[9*n+3*i+j]*J[2][j];
+            }
+        }
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(rangeVariance,fused[9*n+8],covarianceTol*rangeVariance);
+    }
+
+    //and the inverse transforms undo it
+    aerToECFCovariance(2,aerPositions,fused,back,frame);
+    for (int n = 0; n < 2; n++) {
+        assertMatrixEqual(ecf + 9*n,back + 9*n,1e-8);
+    }
+    aerToDCACovariance(2,aerPositions,aer,back);
+    for (int n = 0; n < 2; n++) {
+        assertMatrixEqual(dca + 9*n,back + 9*n,1e-8);
+    }
+}
@@ -0,0 +1,43 @@
+/**
+ * @brief Covariance transformation tester definition.
+ * @file covarianceTransformsTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the analytic Jacobians and the batch covariance
+ * transforms against finite differences and against each other.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef COVARIANCETRANSFORMSTEST_H
+#define	COVARIANCETRANSFORMSTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class covarianceTransformsTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(covarianceTransformsTest);
+
+    CPPUNIT_TEST(testPolarJacobians);
+    CPPUNIT_TEST(testECFJacobian);
+    CPPUNIT_TEST(testSingular);
+    CPPUNIT_TEST(testRotations);
+    CPPUNIT_TEST(testPolarCovariances);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    covarianceTransformsTest();
+    virtual ~covarianceTransformsTest();
+    void setUp();
+    void tearDown();
+
+private:
+    void testPolarJacobians();
+    void testECFJacobian();
+    void testSingular();
+    void testRotations();
+    void testPolarCovariances();
+};
+
+#endif	/* COVARIANCETRANSFORMSTEST_H */
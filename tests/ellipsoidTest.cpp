@@ -0,0 +1,161 @@
+/**
+ * @brief Compile-time reference ellipsoids tester implementation.
+ * @file ellipsoidTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the ellipsoid policies, their derived constants
+ * and the conversions templated on them, including the spherical fast path.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include "ellipsoidTest.h"
+#include "include/coordinateSystems.h"
+#include "include/conversionKernels.h"
+#include "include/batchConversions.h"
+
+using namespace coordinateSystems;
+using namespace coordinateSystems::kernels;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(ellipsoidTest);
+
+struct testDefinition {
+    static constexpr double a = 3396190.0;
+    static constexpr double e2 = 0.01177586;
+};
+typedef ellipsoid<testDefinition> testEllipsoid;
+
+//the derived constants are usable in constant expressions
+static_assert(WGS84::oneMinusE2 == 1.0 - WGS84::e2, "oneMinusE2");
+static_assert(WGS84::b > 6356752.3 && WGS84::b < 6356752.4, "WGS84 semi-minor axis");
+static_assert(sphere::spherical && !WGS84::spherical && !GRS80::spherical, "spherical flag");
+static_assert(sphere::b == sphere::a, "sphere semi-minor axis");
+
+ellipsoidTest::ellipsoidTest() {
+}
+
+ellipsoidTest::~ellipsoidTest() {
+}
+
+void ellipsoidTest::setUp() {
+    _latitude = 10.0;
+    _longitude = 20.0;
+    _altitude = 30.0;
+}
+
+void ellipsoidTest::tearDown() {
+}
+
+void ellipsoidTest::testDerivedConstants() {
+    CPPUNIT_ASSERT_EQUAL(earthCentered::a,WGS84::a);
+    CPPUNIT_ASSERT_EQUAL(earthCentered::e2,WGS84::e2);
+    CPPUNIT_ASSERT_EQUAL(sqrt(pow(WGS84::a,2)*(1-WGS84::e2)),WGS84::b);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sqrt(1-WGS84::e2),WGS84::ratio,1e-16);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(WGS84::e2/(1-WGS84::e2),WGS84::ep2,1e-18);
+    CPPUNIT_ASSERT_EQUAL(WGS84::a*WGS84::e2,WGS84::aE2);
+    CPPUNIT_ASSERT_EQUAL(WGS84::e2*WGS84::e2,WGS84::e4);
+
+    //GRS80 differs from WGS84 only in the flattening, by about 0.1 mm in b
+    CPPUNIT_ASSERT_EQUAL(WGS84::a,GRS80::a);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(WGS84::b,GRS80::b,0.001);
+    CPPUNIT_ASSERT(WGS84::b != GRS80::b);
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sqrt(pow(testEllipsoid::a,2)*(1-testEllipsoid::e2)),testEllipsoid::b,1e-9);
+}
+
+void ellipsoidTest::testWGS84() {
+    double x, y, z, latitude, longitude, altitude;
+    ECF expected = LLA(_latitude,_longitude,_altitude).toECF();
+
+    llaToECFEllipsoid<WGS84>(_latitude,_longitude,_altitude,x,y,z);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),x,ellipsoidTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),y,ellipsoidTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),z,ellipsoidTol);
+
+    ecfToLLAEllipsoid<WGS84>(x,y,z,latitude,longitude,altitude);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_latitude,latitude,ellipsoidTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_longitude,longitude,ellipsoidTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_altitude,altitude,ellipsoidTol);
+
+    //the same ECF point sits at a slightly different height on GRS80
+    ecfToLLAEllipsoid<GRS80>(x,y,z,latitude,longitude,altitude);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_latitude,latitude,1e-8);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_altitude,altitude,0.001);
+}
+
+void ellipsoidTest::testSphere() {
+    double x, y, z, latitude, longitude, altitude;
+
+    llaToECFEllipsoid<sphere>(_latitude,_longitude,_altitude,x,y,z);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(sphere::a + _altitude,sqrt(x*x + y*y + z*z),ellipsoidTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_latitude,atan2(z,sqrt(x*x + y*y))*degPerRad,1e-12);
+
+    ecfToLLAEllipsoid<sphere>(x,y,z,latitude,longitude,altitude);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_latitude,latitude,1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_longitude,longitude,1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_altitude,altitude,ellipsoidTol);
+
+    //poles and the centre need no special case
+    ecfToLLAEllipsoid<sphere>(0.0,0.0,-sphere::a - 300.0,latitude,longitude,altitude);
+    CPPUNIT_ASSERT_EQUAL(-90.0,latitude);
+    CPPUNIT_ASSERT_EQUAL(300.0,altitude);
+    ecfToLLAEllipsoid<sphere>(0.0,0.0,0.0,latitude,longitude,altitude);
+    CPPUNIT_ASSERT_EQUAL(0.0,latitude);
+    CPPUNIT_ASSERT_EQUAL(-sphere::a,altitude);
+
+    //float runs the same path
+    float xF, yF, zF;
+    llaToECFEllipsoid<sphere>((float)_latitude,(float)_longitude,(float)_altitude,xF,yF,zF);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(x,xF,1.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(z,zF,1.0);
+}
+
+void ellipsoidTest::testUserDefined() {
+    double x, y, z, latitude, longitude, altitude;
+
+    llaToECFEllipsoid<testEllipsoid>(_latitude,_longitude,_altitude,x,y,z);
+    double N = testEllipsoid::a/sqrt(1 - testEllipsoid::e2*pow(sin(_latitude*radPerDeg),2));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL((N*testEllipsoid::oneMinusE2 + _altitude)*sin(_latitude*radPerDeg),z,ellipsoidTol);
+
+    ecfToLLAEllipsoid<testEllipsoid>(x,y,z,latitude,longitude,altitude);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_latitude,latitude,ellipsoidTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_longitude,longitude,ellipsoidTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_altitude,altitude,ellipsoidTol);
+}
+
+void ellipsoidTest::testBatch() {
+    const int count = 11;
+    double lla[count][3], ecf[count][3], back[count][3];
+    simdLevel saved = getSimdLevel();
+
+    for (int i = 0; i < count; i++) {
+        lla[i][0] = -90.0 + 18.0*i;
+        lla[i][1] = -180.0 + 33.0*i;
+        lla[i][2] = 1000.0*i;
+    }
+    for (int level = SIMD_NONE; level <= getSupportedSimdLevel(); level++) {
+        setSimdLevel((simdLevel)level);
+
+        llaToECF<sphere>(count,&lla[0][0],&ecf[0][0]);
+        ecfToLLA<sphere>(count,&ecf[0][0],&back[0][0]);
+        for (int i = 0; i < count; i++) {
+            double x, y, z;
+            llaToECFEllipsoid<sphere>(lla[i][0],lla[i][1],lla[i][2],x,y,z);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(x,ecf[i][0],ellipsoidTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(y,ecf[i][1],ellipsoidTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(z,ecf[i][2],ellipsoidTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(lla[i][0],back[i][0],1e-9);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(lla[i][2],back[i][2],ellipsoidTol);
+        }
+
+        llaToECF<GRS80>(count,&lla[0][0],&ecf[0][0]);
+        ecfToLLA<GRS80>(count,&ecf[0][0],&back[0][0]);
+        for (int i = 0; i < count; i++) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(lla[i][0],back[i][0],1e-9);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(lla[i][2],back[i][2],ellipsoidTol);
+        }
+    }
+    setSimdLevel(saved);
+}
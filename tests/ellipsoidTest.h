@@ -0,0 +1,46 @@
+/**
+ * @brief Compile-time reference ellipsoids tester definition.
+ * @file ellipsoidTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the ellipsoid policies, their derived constants
+ * and the conversions templated on them, including the spherical fast path.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef ELLIPSOIDTEST_H
+#define	ELLIPSOIDTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#define ellipsoidTol 1.0e-6 //tolerance for matching conversions (meters, degrees)
+
+class ellipsoidTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(ellipsoidTest);
+
+    CPPUNIT_TEST(testDerivedConstants);
+    CPPUNIT_TEST(testWGS84);
+    CPPUNIT_TEST(testSphere);
+    CPPUNIT_TEST(testUserDefined);
+    CPPUNIT_TEST(testBatch);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    ellipsoidTest();
+    virtual ~ellipsoidTest();
+    void setUp();
+    void tearDown();
+
+private:
+    double _latitude, _longitude, _altitude;
+    void testDerivedConstants();
+    void testWGS84();
+    void testSphere();
+    void testUserDefined();
+    void testBatch();
+};
+
+#endif	/* ELLIPSOIDTEST_H */
@@ -0,0 +1,171 @@
+/**
+ * @brief Frame registry tester implementation.
+ * @file frameRegistryTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the frame registry, the frame cache and the
+ * sharing of frames by ENU, DCA and AER points.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <thread>
+#include <vector>
+#include "frameRegistryTest.h"
+#include "include/coordinateSystems.h"
+#include "include/localFrame.h"
+
+#define frameTol 1e-9
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(frameRegistryTest);
+
+frameRegistryTest::frameRegistryTest() {
+}
+
+frameRegistryTest::~frameRegistryTest() {
+}
+
+void frameRegistryTest::setUp() {
+}
+
+void frameRegistryTest::tearDown() {
+}
+
+void frameRegistryTest::testIntern() {
+    frameHandle frame = FrameRegistry::intern(38.0,-77.0,100.0,30.0);
+    CPPUNIT_ASSERT(frame == FrameRegistry::intern(38.0,-77.0,100.0,30.0));
+    CPPUNIT_ASSERT(frame != FrameRegistry::intern(38.0,-77.0,100.0,31.0));
+    CPPUNIT_ASSERT(frame != FrameRegistry::intern(38.0,-77.0,101.0,30.0));
+    CPPUNIT_ASSERT(FrameRegistry::internHeading(30.0) == FrameRegistry::internHeading(30.0));
+    CPPUNIT_ASSERT(FrameRegistry::internHeading(0.0) != FrameRegistry::intern(0.0,0.0,0.0,0.0));
+    CPPUNIT_ASSERT(!FrameRegistry::internHeading(30.0)->originSet);
+    CPPUNIT_ASSERT(frame->originSet);
+    CPPUNIT_ASSERT_EQUAL(30.0,frame->heading);
+}
+
+void frameRegistryTest::testFrameData() {
+    LocalFrame local(38.0,-77.0,100.0,30.0);
+    frameHandle frame = FrameRegistry::intern(38.0,-77.0,100.0,30.0);
+    ECF origin = local.getOriginECF();
+    double enu[3][3], dca[3][3];
+    local.getRotation(enu);
+    local.getDCARotation(dca);
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(origin.getFirstCoordinate(),frame->originECF[0],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(origin.getSecondCoordinate(),frame->originECF[1],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(origin.getThirdCoordinate(),frame->originECF[2],frameTol);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(enu[i][j],frame->enuRotation[i][j],frameTol);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(dca[i][j],frame->dcaRotation[i][j],frameTol);
+        }
+    }
+}
+
+void frameRegistryTest::testSharing() {
+    LLA origin(38.0,-77.0,100.0);
+    ECF ecf = LLA(38.5,-76.5,2000.0).toECF();
+    LocalFrame local(origin,30.0);
+
+    DCA dca = ecf.toDCA(origin,30.0);
+    AER aer = ecf.toAER(38.0,-77.0,100.0,30.0);
+    CPPUNIT_ASSERT(dca.getFrame() == aer.getFrame());
+    CPPUNIT_ASSERT(dca.getFrame() == local.toDCA(ecf).getFrame());
+    CPPUNIT_ASSERT(dca.getFrame() == dca.toAER().getFrame());
+    CPPUNIT_ASSERT(dca.getFrame() == aer.toDCA().getFrame());
+    CPPUNIT_ASSERT(ecf.toENU(origin).getFrame() == dca.toENU().getFrame());
+    CPPUNIT_ASSERT(ecf.toENU(origin).getFrame() == local.toENU(ecf).getFrame());
+
+    //changing the origin or heading moves the point to another frame
+    frameHandle before = dca.getFrame();
+    dca.setHeading(45.0);
+    CPPUNIT_ASSERT(before != dca.getFrame());
+    CPPUNIT_ASSERT_EQUAL(45.0,dca.getHeading());
+    CPPUNIT_ASSERT_EQUAL(38.0,dca.getOrigin().getFirstCoordinate());
+    dca.setOrigin(39.0,-77.0,100.0);
+    CPPUNIT_ASSERT(dca.getFrame() == FrameRegistry::intern(39.0,-77.0,100.0,45.0));
+
+    //shared frames convert like the points they replace
+    ECF back = aer.toECF();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(ecf.getFirstCoordinate(),back.getFirstCoordinate(),1e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(ecf.getSecondCoordinate(),back.getSecondCoordinate(),1e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(ecf.getThirdCoordinate(),back.getThirdCoordinate(),1e-6);
+}
+
+void frameRegistryTest::testLifetime() {
+    FrameCache::clear();
+    size_t before = FrameRegistry::size();
+    {
+        std::vector<ENU> points;
+        for (int i = 0; i < 1000; i++) {
+            points.push_back(ENU(i,i,i,12.5,34.5,56.5));
+        }
+        CPPUNIT_ASSERT_EQUAL(before+1,FrameRegistry::size());
+        //the points, the cache slot and the returned handle
+        CPPUNIT_ASSERT_EQUAL((long) 1002,points[0].getFrame().use_count());
+    }
+    //the cache keeps the frame until its slot is cleared or replaced
+    CPPUNIT_ASSERT_EQUAL(before+1,FrameRegistry::size());
+    FrameCache::clear();
+    CPPUNIT_ASSERT_EQUAL(before,FrameRegistry::size());
+}
+
+void frameRegistryTest::testCache() {
+    ECF ecf = LLA(38.5,-76.5,2000.0).toECF();
+    FrameCache::clear();
+    FrameCache::resetStatistics();
+
+    frameHandle frame = FrameCache::get(38.0,-77.0,100.0,30.0);
+    CPPUNIT_ASSERT(frame == FrameRegistry::intern(38.0,-77.0,100.0,30.0));
+    CPPUNIT_ASSERT(frame == FrameCache::get(38.0,-77.0,100.0,30.0));
+    CPPUNIT_ASSERT(FrameCache::getHeading(30.0) == FrameRegistry::internHeading(30.0));
+    FrameCache::statistics stats = FrameCache::getStatistics();
+    CPPUNIT_ASSERT_EQUAL((uint64_t) 1,stats.hits);
+    CPPUNIT_ASSERT_EQUAL((uint64_t) 2,stats.misses);
+
+    //repeated raw-coordinate conversions hit the cache
+    FrameCache::resetStatistics();
+    for (int i = 0; i < 100; i++) {
+        CPPUNIT_ASSERT(ecf.toAER(38.0,-77.0,100.0,30.0).getFrame() == frame);
+    }
+    stats = FrameCache::getStatistics();
+    CPPUNIT_ASSERT_EQUAL((uint64_t) 100,stats.hits);
+    CPPUNIT_ASSERT_EQUAL((uint64_t) 0,stats.misses);
+
+    //more origins than slots: frames are replaced, never wrong
+    for (unsigned i = 0; i < 4*FrameCache::slotCount; i++) {
+        frameHandle other = FrameCache::get(i,0.0,0.0);
+        CPPUNIT_ASSERT_EQUAL((double) i,other->latitude);
+    }
+    CPPUNIT_ASSERT(frame == FrameCache::get(38.0,-77.0,100.0,30.0));
+
+    //lookups of exited threads are still counted
+    FrameCache::resetStatistics();
+    std::vector<std::thread> threads;
+    bool matched[4] = {false, false, false, false};
+    for (int t = 0; t < 4; t++) {
+        threads.push_back(std::thread([t, &matched](){
+            bool match = true;
+            for (int i = 0; i < 1000; i++) {
+                match = match && FrameCache::get(10.0*(i%8),t,0.0)->longitude == t;
+            }
+            matched[t] = match;
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++) {
+        threads[t].join();
+        CPPUNIT_ASSERT(matched[t]);
+    }
+    stats = FrameCache::getStatistics();
+    CPPUNIT_ASSERT_EQUAL((uint64_t) 4000,stats.hits + stats.misses);
+    CPPUNIT_ASSERT(stats.hits >= 4000 - 4*8);
+}
+
+void frameRegistryTest::testFootprint() {
+    //one handle instead of an origin, a heading and an origin flag per point
+    CPPUNIT_ASSERT(sizeof(ENU) <= sizeof(Cartesian) + sizeof(void*) + sizeof(frameHandle));
+    CPPUNIT_ASSERT(sizeof(AER) <= sizeof(Spherical) + sizeof(void*) + sizeof(frameHandle));
+}
@@ -0,0 +1,45 @@
+/**
+ * @brief Frame registry tester definition.
+ * @file frameRegistryTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the frame registry, the frame cache and the
+ * sharing of frames by ENU, DCA and AER points.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef FRAMEREGISTRYTEST_H
+#define	FRAMEREGISTRYTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class frameRegistryTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(frameRegistryTest);
+
+    CPPUNIT_TEST(testIntern);
+    CPPUNIT_TEST(testFrameData);
+    CPPUNIT_TEST(testSharing);
+    CPPUNIT_TEST(testLifetime);
+    CPPUNIT_TEST(testCache);
+    CPPUNIT_TEST(testFootprint);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    frameRegistryTest();
+    virtual ~frameRegistryTest();
+    void setUp();
+    void tearDown();
+
+private:
+    void testIntern();
+    void testFrameData();
+    void testSharing();
+    void testLifetime();
+    void testCache();
+    void testFootprint();
+};
+
+#endif	/* FRAMEREGISTRYTEST_H */
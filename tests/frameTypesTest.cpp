@@ -0,0 +1,162 @@
+/**
+ * @brief Frame-tagged value types tester implementation.
+ * @file frameTypesTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the Vec3 value types, their conversions and
+ * adapters against the coordinate systems classes.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <string.h>
+#include <type_traits>
+#include "frameTypesTest.h"
+#include "include/frameTypes.h"
+#include "include/batchConversions.h"
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(frameTypesTest);
+
+frameTypesTest::frameTypesTest() {
+}
+
+frameTypesTest::~frameTypesTest() {
+}
+
+void frameTypesTest::setUp() {
+    _latitude = 10.0;
+    _longitude = 20.0;
+    _altitude = 30.0;
+    _heading = 55.5;
+}
+
+void frameTypesTest::tearDown() {
+}
+
+void frameTypesTest::testLayout() {
+    AERVec values[2] = {AERVec(1.0,2.0,3.0), AERVec(4.0,5.0,6.0)};
+    double raw[6];
+
+    CPPUNIT_ASSERT(std::is_trivially_copyable<LLAVec>::value);
+    CPPUNIT_ASSERT(std::is_trivially_copyable<AERVec>::value);
+    CPPUNIT_ASSERT_EQUAL(3*sizeof(double),sizeof(ENUVec));
+    CPPUNIT_ASSERT_EQUAL(6*sizeof(double),sizeof(values));
+    //arrays of values are interleaved triples, ready for the batch conversions
+    memcpy(raw,values,sizeof(values));
+    CPPUNIT_ASSERT_EQUAL(3.0,raw[2]);
+    CPPUNIT_ASSERT_EQUAL(4.0,raw[3]);
+    CPPUNIT_ASSERT(!(std::is_same<ENUVec,DCAVec>::value));
+
+    LLAVec lla[2] = {LLAVec(10.0,20.0,30.0), LLAVec(-45.0,170.0,0.0)};
+    ECFVec ecf[2];
+    llaToECF(2,lla,ecf);
+    for (int i = 0; i < 2; i++) {
+        ECF expected = toClass(lla[i]).toECF();
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),ecf[i].first,1.0e-4);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),ecf[i].second,1.0e-4);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),ecf[i].third,1.0e-4);
+    }
+}
+
+void frameTypesTest::testConstexpr() {
+    constexpr ECFVec origin;
+    constexpr ECFVec point(1.0,2.0,3.0);
+    static_assert(point.second == 2.0, "constexpr construction");
+    static_assert(point != origin, "constexpr comparison");
+    static_assert(ECFVec(1.0,2.0,3.0) == point, "constexpr comparison");
+    CPPUNIT_ASSERT_EQUAL(0.0,origin.third);
+}
+
+void frameTypesTest::testAdapters() {
+    LLA origin(_latitude,_longitude,_altitude);
+
+    ECF ecf = toClass(toVec3(ECF(1.5,-2.5,3.5)));
+    CPPUNIT_ASSERT_EQUAL(-2.5,ecf.getSecondCoordinate());
+    LLA lla = toClass(toVec3(origin));
+    CPPUNIT_ASSERT_EQUAL(_longitude,lla.getSecondCoordinate());
+
+    ENU enu = toClass(toVec3(ENU(1.0,2.0,3.0,origin)),origin);
+    CPPUNIT_ASSERT_EQUAL(3.0,enu.getThirdCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_latitude,enu.getOrigin().getFirstCoordinate());
+    DCA dca = toClass(toVec3(DCA(4.0,5.0,6.0,origin,_heading)),origin,_heading);
+    CPPUNIT_ASSERT_EQUAL(5.0,dca.getSecondCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_heading,dca.getHeading());
+    AER aer = toClass(toVec3(AER(7.0,8.0,9.0)),_heading);
+    CPPUNIT_ASSERT_EQUAL(7.0,aer.getFirstCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_heading,aer.getHeading());
+}
+
+void frameTypesTest::testGeodeticConversions() {
+    LLA lla(-33.3,151.2,120.0);
+    ECF expected = lla.toECF();
+    ECFVec ecf = toECF(toVec3(lla));
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),ecf.first,vecTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),ecf.second,vecTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),ecf.third,vecTol);
+
+    LLA back = expected.toLLA();
+    LLAVec result = toLLA(ecf);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(back.getFirstCoordinate(),result.first,vecTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(back.getSecondCoordinate(),result.second,vecTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(back.getThirdCoordinate(),result.third,vecTol);
+}
+
+void frameTypesTest::testLocalConversions() {
+    double points[4][3] = {{1111.11, 222.22, 333.33}, {0.0, 0.0, 100.0}, {0.0, 0.0, -5.0}, {0.0, 0.0, 0.0}};
+
+    for (int i = 0; i < 4; i++) {
+        DCA dca(points[i][0],points[i][1],points[i][2]);
+        AER aer = dca.toAER();
+        AERVec aerVec = toAER(toVec3(dca));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(aer.getFirstCoordinate(),aerVec.first,vecTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(aer.getSecondCoordinate(),aerVec.second,vecTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(aer.getThirdCoordinate(),aerVec.third,vecTol);
+
+        DCA back = aer.toDCA();
+        DCAVec backVec = toDCA(aerVec);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(back.getFirstCoordinate(),backVec.first,vecTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(back.getSecondCoordinate(),backVec.second,vecTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(back.getThirdCoordinate(),backVec.third,vecTol);
+
+        ENU enu(points[i][0],points[i][1],points[i][2]);
+        AER expected = enu.toAER(_heading);
+        AERVec result = toAER(toVec3(enu),_heading);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.first,vecTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.second,vecTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.third,vecTol);
+
+        ENUVec enuVec = toENU(result,_heading);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[i][0],enuVec.first,vecTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[i][1],enuVec.second,vecTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(points[i][2],enuVec.third,vecTol);
+    }
+}
+
+void frameTypesTest::testLocalFrame() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    ECF ecf(-3000000.0,4000000.0,3500000.0);
+    ECFVec ecfVec = toVec3(ecf);
+
+    ENU enu = frame.toENU(ecf);
+    ENUVec enuVec = frame.toENU(ecfVec);
+    CPPUNIT_ASSERT_EQUAL(enu.getFirstCoordinate(),enuVec.first);
+    CPPUNIT_ASSERT_EQUAL(enu.getSecondCoordinate(),enuVec.second);
+    CPPUNIT_ASSERT_EQUAL(enu.getThirdCoordinate(),enuVec.third);
+
+    AER aer = frame.toAER(ecf);
+    AERVec aerVec = frame.toAER(ecfVec);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(aer.getFirstCoordinate(),aerVec.first,vecTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(aer.getSecondCoordinate(),aerVec.second,vecTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(aer.getThirdCoordinate(),aerVec.third,vecTol);
+
+    ECFVec back = frame.toECF(aerVec);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(ecfVec.first,back.first,1.0e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(ecfVec.second,back.second,1.0e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(ecfVec.third,back.third,1.0e-6);
+    back = frame.toECF(frame.toDCA(ecfVec));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(ecfVec.first,back.first,1.0e-6);
+}
@@ -0,0 +1,49 @@
+/**
+ * @brief Frame-tagged value types tester definition.
+ * @file frameTypesTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the Vec3 value types, their conversions and
+ * adapters against the coordinate systems classes.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef FRAMETYPESTEST_H
+#define	FRAMETYPESTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#define vecTol 1.0e-9 //tolerance for matching the class conversions (meters, degrees)
+
+class frameTypesTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(frameTypesTest);
+
+    CPPUNIT_TEST(testLayout);
+    CPPUNIT_TEST(testConstexpr);
+    CPPUNIT_TEST(testAdapters);
+    CPPUNIT_TEST(testGeodeticConversions);
+    CPPUNIT_TEST(testLocalConversions);
+    CPPUNIT_TEST(testLocalFrame);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    frameTypesTest();
+    virtual ~frameTypesTest();
+    void setUp();
+    void tearDown();
+
+private:
+    double _latitude, _longitude, _altitude;
+    double _heading;
+    void testLayout();
+    void testConstexpr();
+    void testAdapters();
+    void testGeodeticConversions();
+    void testLocalConversions();
+    void testLocalFrame();
+};
+
+#endif	/* FRAMETYPESTEST_H */
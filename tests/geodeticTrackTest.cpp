@@ -0,0 +1,140 @@
+/**
+ * @brief Warm-started ECF to LLA conversion tester implementation.
+ * @file geodeticTrackTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the GeodeticTrack converter: accuracy and
+ * iteration counts along smooth tracks, restarts after jumps, the poles and
+ * the batch method.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include <vector>
+#include "geodeticTrackTest.h"
+#include "include/geodeticTrack.h"
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(geodeticTrackTest);
+
+/*
+ * Converts a track point by point, checks every point against the
+ * GEODETIC_MILLIMETRE solver and returns the number of points that took
+ * more than one iteration.
+ */
+static size_t checkTrack(GeodeticTrack &track, const std::vector<double> &lla){
+    size_t slow = 0;
+    for (size_t i = 0; i < lla.size()/3; i++) {
+        double x, y, z, latitude, longitude, altitude;
+        double expectedLatitude, expectedLongitude, expectedAltitude;
+        LLA::toECF(lla[3*i],lla[3*i+1],lla[3*i+2],x,y,z);
+        ECF::toLLA(x,y,z,expectedLatitude,expectedLongitude,expectedAltitude,GEODETIC_MILLIMETRE);
+        track.toLLA(x,y,z,latitude,longitude,altitude);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedLatitude,latitude,trackLatTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedLongitude,longitude,trackLatTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedAltitude,altitude,trackAltTol);
+        if (track.getIterations() > 1) {
+            slow++;
+        }
+    }
+    return slow;
+}
+
+geodeticTrackTest::geodeticTrackTest() {
+}
+
+geodeticTrackTest::~geodeticTrackTest() {
+}
+
+void geodeticTrackTest::setUp() {
+}
+
+void geodeticTrackTest::tearDown() {
+}
+
+void geodeticTrackTest::testSmoothTrack() {
+    //aircraft at 250 m/s sampled at 1 Hz, weaving and climbing
+    GeodeticTrack track;
+    std::vector<double> lla;
+    for (int t = 0; t < 5000; t++) {
+        lla.push_back(35.0 + 0.002*t*cos(t*0.002));
+        lla.push_back(-100.0 + 0.0025*t);
+        lla.push_back(500.0 + 2.0*t);
+    }
+    size_t slow = checkTrack(track,lla);
+    CPPUNIT_ASSERT(slow < 10); //the first points only
+}
+
+void geodeticTrackTest::testOrbit() {
+    //low Earth orbit sampled every second, crossing the equator and the highest latitudes
+    GeodeticTrack track;
+    std::vector<double> lla;
+    double inclination = 51.6*PI/180;
+    for (int t = 0; t < 3000; t++) {
+        double angle = t*7670.0/6.778e6;
+        lla.push_back(asin(sin(angle)*sin(inclination))*180/PI);
+        lla.push_back(atan2(cos(inclination)*sin(angle),cos(angle))*180/PI);
+        lla.push_back(400000.0);
+    }
+    size_t slow = checkTrack(track,lla);
+    CPPUNIT_ASSERT(slow < 10);
+}
+
+void geodeticTrackTest::testJumps() {
+    //unrelated points: every one restarts or iterates, all stay accurate
+    GeodeticTrack track;
+    std::vector<double> lla;
+    for (int i = 0; i < 2000; i++) {
+        lla.push_back(fmod(i*71.3,179.0) - 89.5);
+        lla.push_back(fmod(i*133.7,360.0) - 180.0);
+        lla.push_back(fmod(i*7919.0,40.0e6) - 500.0);
+    }
+    checkTrack(track,lla);
+
+    track.reset();
+    track.toLLA(ECF(6378137.0,0.0,0.0));
+    CPPUNIT_ASSERT(track.getIterations() >= 1);
+    CPPUNIT_ASSERT(track.getIterations() <= earthCentered::maxIterations);
+}
+
+void geodeticTrackTest::testPoles() {
+    GeodeticTrack track;
+    std::vector<double> lla;
+    for (int i = 0; i < 100; i++) {
+        lla.push_back(89.999 + i*0.00001);
+        lla.push_back(45.0);
+        lla.push_back(100.0*i);
+    }
+    checkTrack(track,lla);
+
+    LLA pole = track.toLLA(ECF(0.0,0.0,-6356752.314245));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-90.0,pole.getFirstCoordinate(),trackLatTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,pole.getThirdCoordinate(),trackAltTol);
+}
+
+void geodeticTrackTest::testBatch() {
+    GeodeticTrack serial, batch;
+    std::vector<double> ecf(3*1000), lla(3*1000);
+    for (int i = 0; i < 1000; i++) {
+        LLA::toECF(10.0 + 0.01*i,20.0,1000.0 + i,ecf[3*i],ecf[3*i+1],ecf[3*i+2]);
+    }
+    batch.toLLA(1000,&ecf[0],&lla[0]);
+    for (int i = 0; i < 1000; i++) {
+        double latitude, longitude, altitude;
+        serial.toLLA(ecf[3*i],ecf[3*i+1],ecf[3*i+2],latitude,longitude,altitude);
+        CPPUNIT_ASSERT_EQUAL(latitude,lla[3*i]);
+        CPPUNIT_ASSERT_EQUAL(longitude,lla[3*i+1]);
+        CPPUNIT_ASSERT_EQUAL(altitude,lla[3*i+2]);
+    }
+    CPPUNIT_ASSERT_EQUAL(serial.getIterations(),batch.getIterations());
+
+    //in place
+    batch.reset();
+    batch.toLLA(1000,&ecf[0],&ecf[0]);
+    for (size_t i = 0; i < ecf.size(); i++) {
+        CPPUNIT_ASSERT_EQUAL(lla[i],ecf[i]);
+    }
+}
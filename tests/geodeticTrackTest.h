@@ -0,0 +1,47 @@
+/**
+ * @brief Warm-started ECF to LLA conversion tester definition.
+ * @file geodeticTrackTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the GeodeticTrack converter: accuracy and
+ * iteration counts along smooth tracks, restarts after jumps, the poles and
+ * the batch method.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef GEODETICTRACKTEST_H
+#define	GEODETICTRACKTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#define trackLatTol 1.0e-10 //tolerance for latitude and longitude (degrees)
+#define trackAltTol 1.0e-6 //tolerance for altitude (meters)
+
+class geodeticTrackTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(geodeticTrackTest);
+
+    CPPUNIT_TEST(testSmoothTrack);
+    CPPUNIT_TEST(testOrbit);
+    CPPUNIT_TEST(testJumps);
+    CPPUNIT_TEST(testPoles);
+    CPPUNIT_TEST(testBatch);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    geodeticTrackTest();
+    virtual ~geodeticTrackTest();
+    void setUp();
+    void tearDown();
+
+private:
+    void testSmoothTrack();
+    void testOrbit();
+    void testJumps();
+    void testPoles();
+    void testBatch();
+};
+
+#endif	/* GEODETICTRACKTEST_H */
@@ -0,0 +1,157 @@
+/**
+ * @brief Hot-path instrumentation tester implementation.
+ * @file instrumentationTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the per-thread counters, the iteration and
+ * latency histograms, the snapshot API and, when the library is built with
+ * COORDINATESYSTEMS_INSTRUMENTATION, the hooks in the conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <string.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "instrumentationTest.h"
+#include "include/coordinateSystems.h"
+#include "include/batchConversions.h"
+#include "include/instrumentation.h"
+
+using namespace coordinateSystems;
+using namespace coordinateSystems::instrumentation;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(instrumentationTest);
+
+static uint64_t iterationTotal(const snapshot &s, unsigned bin){
+    uint64_t total = 0;
+    for (unsigned band = 0; band < altitudeBands; band++) {
+        total += s.iterations[band][bin];
+    }
+    return total;
+}
+
+instrumentationTest::instrumentationTest() {
+}
+
+instrumentationTest::~instrumentationTest() {
+}
+
+void instrumentationTest::setUp() {
+    reset();
+}
+
+void instrumentationTest::tearDown() {
+}
+
+void instrumentationTest::testCounters() {
+    snapshot s = getSnapshot();
+    for (unsigned i = 0; i < COUNTER_COUNT; i++) {
+        CPPUNIT_ASSERT_EQUAL((uint64_t)0,s.counters[i]);
+    }
+
+    count(COUNTER_BATCH_POINTS,1000);
+    count(COUNTER_BATCH_POINTS,24);
+    count(COUNTER_ORIGIN_NOT_SET,1);
+    s = getSnapshot();
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1024,s.counters[COUNTER_BATCH_POINTS]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.counters[COUNTER_ORIGIN_NOT_SET]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0,s.counters[COUNTER_BATCH_CALLS]);
+
+    reset();
+    s = getSnapshot();
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0,s.counters[COUNTER_BATCH_POINTS]);
+}
+
+void instrumentationTest::testHistograms() {
+    recordIterations(3,-100.0); //below the ellipsoid
+    recordIterations(3,5000.0);
+    recordIterations(2,5.0e5);
+    recordIterations(40,3.6e7); //clamped to the last bin
+    recordLatency(TIMER_ECF_TO_LLA,0);
+    recordLatency(TIMER_ECF_TO_LLA,1);
+    recordLatency(TIMER_ECF_TO_LLA,300); //[256, 512)
+    recordLatency(TIMER_BATCH_CALL,~(uint64_t)0);
+
+    snapshot s = getSnapshot();
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.iterations[0][3]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.iterations[1][3]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.iterations[3][2]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.iterations[altitudeBands-1][iterationBins-1]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)2,iterationTotal(s,3));
+    CPPUNIT_ASSERT_EQUAL((uint64_t)2,s.latency[TIMER_ECF_TO_LLA][0]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.latency[TIMER_ECF_TO_LLA][8]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.latency[TIMER_BATCH_CALL][latencyBins-1]);
+}
+
+void instrumentationTest::testThreads() {
+    const unsigned threadCount = 4;
+    std::vector<std::thread> threads;
+
+    //counts of exited threads are kept
+    for (unsigned t = 0; t < threadCount; t++) {
+        threads.push_back(std::thread([](){
+            for (int i = 0; i < 10000; i++) {
+                count(COUNTER_TO_LOCAL,1);
+            }
+            recordIterations(1,0.0);
+        }));
+    }
+    for (unsigned t = 0; t < threadCount; t++) {
+        threads[t].join();
+    }
+    count(COUNTER_TO_LOCAL,5);
+
+    snapshot s = getSnapshot();
+    CPPUNIT_ASSERT_EQUAL((uint64_t)(threadCount*10000 + 5),s.counters[COUNTER_TO_LOCAL]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)threadCount,s.iterations[1][1]);
+
+    reset();
+    s = getSnapshot();
+    CPPUNIT_ASSERT_EQUAL((uint64_t)0,s.counters[COUNTER_TO_LOCAL]);
+}
+
+void instrumentationTest::testNames() {
+    CPPUNIT_ASSERT(strcmp(counterName(COUNTER_ECF_TO_LLA),"ecf_to_lla") == 0);
+    CPPUNIT_ASSERT(strcmp(counterName(COUNTER_ORIGIN_NOT_SET),"origin_not_set") == 0);
+    CPPUNIT_ASSERT(strcmp(timerName(TIMER_BATCH_CALL),"batch_call") == 0);
+    CPPUNIT_ASSERT_EQUAL(0.0,altitudeBandLimit(0));
+    CPPUNIT_ASSERT_EQUAL(1.0e4,altitudeBandLimit(1));
+    CPPUNIT_ASSERT(isinf(altitudeBandLimit(altitudeBands-1)));
+}
+
+void instrumentationTest::testHooks() {
+    double latitude, longitude, altitude;
+    double ecf[6] = {6378137.0, 0.0, 0.0, 0.0, 6378137.0, 1000.0};
+    double lla[6];
+    ENU enu(1.0,2.0,3.0);
+
+    ECF::toLLA(3194419.0,3194419.0,4487348.0,latitude,longitude,altitude,GEODETIC_MILLIMETRE);
+    ECF::toLLA(4510731.0,4510731.0,0.0,latitude,longitude,altitude,GEODETIC_CLOSED_FORM);
+    ecfToLLA(2,ecf,lla);
+    CPPUNIT_ASSERT_THROW(enu.toECF(),std::runtime_error);
+
+    snapshot s = getSnapshot();
+    if (!enabled()) {
+        //the hooks compile to nothing
+        for (unsigned i = 0; i < COUNTER_COUNT; i++) {
+            CPPUNIT_ASSERT_EQUAL((uint64_t)0,s.counters[i]);
+        }
+        return;
+    }
+    CPPUNIT_ASSERT_EQUAL((uint64_t)2,s.counters[COUNTER_ECF_TO_LLA]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.counters[COUNTER_BATCH_CALLS]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)2,s.counters[COUNTER_BATCH_POINTS]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,s.counters[COUNTER_ORIGIN_NOT_SET]);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,iterationTotal(s,0)); //closed form
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,iterationTotal(s,2)); //millimetre, at the surface
+    uint64_t timed = 0, batches = 0;
+    for (unsigned bin = 0; bin < latencyBins; bin++) {
+        timed += s.latency[TIMER_ECF_TO_LLA][bin];
+        batches += s.latency[TIMER_BATCH_CALL][bin];
+    }
+    CPPUNIT_ASSERT_EQUAL((uint64_t)2,timed);
+    CPPUNIT_ASSERT_EQUAL((uint64_t)1,batches);
+}
@@ -0,0 +1,44 @@
+/**
+ * @brief Hot-path instrumentation tester definition.
+ * @file instrumentationTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the per-thread counters, the iteration and
+ * latency histograms, the snapshot API and, when the library is built with
+ * COORDINATESYSTEMS_INSTRUMENTATION, the hooks in the conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef INSTRUMENTATIONTEST_H
+#define	INSTRUMENTATIONTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class instrumentationTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(instrumentationTest);
+
+    CPPUNIT_TEST(testCounters);
+    CPPUNIT_TEST(testHistograms);
+    CPPUNIT_TEST(testThreads);
+    CPPUNIT_TEST(testNames);
+    CPPUNIT_TEST(testHooks);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    instrumentationTest();
+    virtual ~instrumentationTest();
+    void setUp();
+    void tearDown();
+
+private:
+    void testCounters();
+    void testHistograms();
+    void testThreads();
+    void testNames();
+    void testHooks();
+};
+
+#endif	/* INSTRUMENTATIONTEST_H */
@@ -0,0 +1,272 @@
+/**
+ * @brief Local frame tester implementation.
+ * @file localFrameTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the cached local frame against the coordinate
+ * systems class conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include "localFrameTest.h"
+#include "include/localFrame.h"
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(localFrameTest);
+
+localFrameTest::localFrameTest() {
+}
+
+localFrameTest::~localFrameTest() {
+}
+
+void localFrameTest::setUp() {
+    _X = 6378137.0+1000;
+    _Y = 200000.0;
+    _Z = 30000.0;
+    _latitude = 10.0;
+    _longitude = 20.0;
+    _altitude = 30.0;
+    _heading = 55.5;
+    _first = 1111.11;
+    _second = 222.22;
+    _third = 333.33;
+}
+
+void localFrameTest::tearDown() {
+}
+
+void localFrameTest::testLocalFrame() {
+    LLA _origin(_latitude,_longitude,_altitude);
+    LocalFrame frame1(_origin);
+    LocalFrame frame2(_latitude,_longitude,_altitude,_heading);
+
+    CPPUNIT_ASSERT_EQUAL(_latitude,frame1.getOrigin().getFirstCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_longitude,frame1.getOrigin().getSecondCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_altitude,frame1.getOrigin().getThirdCoordinate());
+    CPPUNIT_ASSERT_EQUAL(0.0,frame1.getHeading());
+
+    CPPUNIT_ASSERT_EQUAL(_latitude,frame2.getOrigin().getFirstCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_longitude,frame2.getOrigin().getSecondCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_altitude,frame2.getOrigin().getThirdCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_heading,frame2.getHeading());
+}
+
+void localFrameTest::testSetHeading() {
+    LocalFrame frame(_latitude,_longitude,_altitude);
+    frame.setHeading(_heading);
+    CPPUNIT_ASSERT_EQUAL(_heading,frame.getHeading());
+
+    DCA result = frame.toDCA(_X,_Y,_Z);
+    DCA expected = ECF(_X,_Y,_Z).toDCA(_latitude,_longitude,_altitude,_heading);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate(),frameTol);
+}
+
+void localFrameTest::testGetOriginECF() {
+    LocalFrame frame(_latitude,_longitude,_altitude);
+    ECF result = frame.getOriginECF();
+    ECF expected = LLA(_latitude,_longitude,_altitude).toECF();
+    CPPUNIT_ASSERT_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate());
+    CPPUNIT_ASSERT_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate());
+    CPPUNIT_ASSERT_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate());
+}
+
+void localFrameTest::testGetRotation() {
+    LocalFrame frame(0.0,0.0,0.0);
+    double R[3][3];
+    frame.getRotation(R);
+
+    //at the origin of ECF longitude and latitude, East = Y, North = Z, Up = X
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,R[0][0],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,R[0][1],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,R[0][2],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,R[1][0],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,R[1][1],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,R[1][2],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0,R[2][0],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,R[2][1],frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0,R[2][2],frameTol);
+}
+
+void localFrameTest::testGetDCARotation() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    double R[3][3], H[3][3], D[3][3];
+    frame.getRotation(R);
+    frame.getHeadingRotation(H);
+    frame.getDCARotation(D);
+
+    //the cached DCA rotation is the heading rotation applied after the ENU rotation
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            double expected = H[i][0]*R[0][j] + H[i][1]*R[1][j] + H[i][2]*R[2][j];
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(expected,D[i][j],frameTol);
+        }
+    }
+
+    //at zero heading down range is North, cross range is West and above is Up
+    frame.setHeading(0.0);
+    frame.getDCARotation(D);
+    for (int j = 0; j < 3; j++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(R[1][j],D[0][j],frameTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(-R[0][j],D[1][j],frameTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(R[2][j],D[2][j],frameTol);
+    }
+}
+
+void localFrameTest::testToENU() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    ECF _ecf(_X,_Y,_Z);
+    ENU expected = _ecf.toENU(_latitude,_longitude,_altitude);
+
+    ENU result1 = frame.toENU(_X,_Y,_Z);
+    ENU result2 = frame.toENU(_ecf);
+    ENU result3 = frame.toENU(_ecf.toLLA());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result1.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result1.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result1.getThirdCoordinate(),frameTol);
+    CPPUNIT_ASSERT_EQUAL(_latitude,result1.getOrigin().getFirstCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_longitude,result1.getOrigin().getSecondCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_altitude,result1.getOrigin().getThirdCoordinate());
+    CPPUNIT_ASSERT_EQUAL(result1.getFirstCoordinate(),result2.getFirstCoordinate());
+    CPPUNIT_ASSERT_EQUAL(result1.getSecondCoordinate(),result2.getSecondCoordinate());
+    CPPUNIT_ASSERT_EQUAL(result1.getThirdCoordinate(),result2.getThirdCoordinate());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result3.getFirstCoordinate(),0.01);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result3.getSecondCoordinate(),0.01);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result3.getThirdCoordinate(),0.01);
+}
+
+void localFrameTest::testToDCA() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    ECF _ecf(_X,_Y,_Z);
+    DCA expected = _ecf.toDCA(_latitude,_longitude,_altitude,_heading);
+
+    DCA result1 = frame.toDCA(_X,_Y,_Z);
+    DCA result2 = frame.toDCA(_ecf);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result1.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result1.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result1.getThirdCoordinate(),frameTol);
+    CPPUNIT_ASSERT_EQUAL(_latitude,result1.getOrigin().getFirstCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_heading,result1.getHeading());
+    CPPUNIT_ASSERT_EQUAL(result1.getFirstCoordinate(),result2.getFirstCoordinate());
+    CPPUNIT_ASSERT_EQUAL(result1.getSecondCoordinate(),result2.getSecondCoordinate());
+    CPPUNIT_ASSERT_EQUAL(result1.getThirdCoordinate(),result2.getThirdCoordinate());
+}
+
+void localFrameTest::testToAER() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    LLA _lla = ECF(_X,_Y,_Z).toLLA();
+    AER expected = _lla.toAER(_latitude,_longitude,_altitude,_heading);
+
+    AER result1 = frame.toAER(_X,_Y,_Z);
+    AER result2 = frame.toAER(_lla);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result1.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result1.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result1.getThirdCoordinate(),0.01);
+    CPPUNIT_ASSERT_EQUAL(_longitude,result1.getOrigin().getSecondCoordinate());
+    CPPUNIT_ASSERT_EQUAL(_heading,result1.getHeading());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result2.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result2.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result2.getThirdCoordinate(),frameTol);
+}
+
+void localFrameTest::testToECF() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    ENU _enu(_first,_second,_third,_latitude,_longitude,_altitude);
+    DCA _dca(_first,_second,_third,_latitude,_longitude,_altitude,_heading);
+    AER _aer(_first,_second,_third,_latitude,_longitude,_altitude,_heading);
+
+    ECF result = frame.toECF(_enu);
+    ECF expected = _enu.toECF();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate(),frameTol);
+
+    result = frame.toECF(_dca);
+    expected = _dca.toECF();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate(),frameTol);
+
+    result = frame.toECF(_aer);
+    expected = _aer.toECF();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate(),frameTol);
+
+    //input origin and heading are ignored in favour of the frame
+    DCA other(_first,_second,_third,0.0,0.0,0.0,0.0);
+    result = frame.toECF(other);
+    expected = _dca.toECF();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate(),frameTol);
+}
+
+void localFrameTest::testToLLA() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    ENU _enu(_first,_second,_third,_latitude,_longitude,_altitude);
+    DCA _dca(_first,_second,_third,_latitude,_longitude,_altitude,_heading);
+    AER _aer(_first,_second,_third,_latitude,_longitude,_altitude,_heading);
+
+    LLA result = frame.toLLA(_enu);
+    LLA expected = _enu.toLLA();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate(),frameTol);
+
+    result = frame.toLLA(_dca);
+    expected = _dca.toLLA();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate(),frameTol);
+
+    result = frame.toLLA(_aer);
+    expected = _aer.toLLA();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getFirstCoordinate(),result.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getSecondCoordinate(),result.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.getThirdCoordinate(),result.getThirdCoordinate(),frameTol);
+}
+
+void localFrameTest::testSensorConversions() {
+    LocalFrame frame(_latitude,_longitude,_altitude,_heading);
+    ENU _enu(_first,_second,_third,_latitude,_longitude,_altitude);
+    DCA _dca(_first,_second,_third,_latitude,_longitude,_altitude,_heading);
+    AER _aer(_first,_second,_third,_latitude,_longitude,_altitude,_heading);
+
+    DCA dca = frame.toDCA(_enu);
+    DCA expectedDCA = _enu.toDCA(_heading);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedDCA.getFirstCoordinate(),dca.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedDCA.getSecondCoordinate(),dca.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedDCA.getThirdCoordinate(),dca.getThirdCoordinate(),frameTol);
+    CPPUNIT_ASSERT_EQUAL(_heading,dca.getHeading());
+
+    AER aer = frame.toAER(_enu);
+    AER expectedAER = _enu.toAER(_heading);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedAER.getFirstCoordinate(),aer.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedAER.getSecondCoordinate(),aer.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedAER.getThirdCoordinate(),aer.getThirdCoordinate(),frameTol);
+
+    ENU enu1 = frame.toENU(_dca);
+    ENU expectedENU1 = _dca.toENU();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU1.getFirstCoordinate(),enu1.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU1.getSecondCoordinate(),enu1.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU1.getThirdCoordinate(),enu1.getThirdCoordinate(),frameTol);
+    CPPUNIT_ASSERT_EQUAL(_latitude,enu1.getOrigin().getFirstCoordinate());
+
+    ENU enu2 = frame.toENU(_aer);
+    ENU expectedENU2 = _aer.toENU();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU2.getFirstCoordinate(),enu2.getFirstCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU2.getSecondCoordinate(),enu2.getSecondCoordinate(),frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedENU2.getThirdCoordinate(),enu2.getThirdCoordinate(),frameTol);
+
+    ENUVec enuVec = frame.toENU(frame.toDCA(toVec3(_enu)));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_first,enuVec.first,frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_second,enuVec.second,frameTol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(_third,enuVec.third,frameTol);
+}
@@ -0,0 +1,62 @@
+/**
+ * @brief Local frame tester definition.
+ * @file localFrameTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the cached local frame against the coordinate
+ * systems class conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef LOCALFRAMETEST_H
+#define	LOCALFRAMETEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#define frameTol 1.0e-6 //tolerance for matching the class conversions (meters, degrees)
+
+class localFrameTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(localFrameTest);
+
+    CPPUNIT_TEST(testLocalFrame);
+    CPPUNIT_TEST(testSetHeading);
+    CPPUNIT_TEST(testGetOriginECF);
+    CPPUNIT_TEST(testGetRotation);
+    CPPUNIT_TEST(testGetDCARotation);
+    CPPUNIT_TEST(testToENU);
+    CPPUNIT_TEST(testToDCA);
+    CPPUNIT_TEST(testToAER);
+    CPPUNIT_TEST(testToECF);
+    CPPUNIT_TEST(testToLLA);
+    CPPUNIT_TEST(testSensorConversions);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    localFrameTest();
+    virtual ~localFrameTest();
+    void setUp();
+    void tearDown();
+
+private:
+    double _X, _Y, _Z;
+    double _latitude, _longitude, _altitude;
+    double _heading;
+    double _first, _second, _third;
+    void testLocalFrame();
+    void testSetHeading();
+    void testGetOriginECF();
+    void testGetRotation();
+    void testGetDCARotation();
+    void testToENU();
+    void testToDCA();
+    void testToAER();
+    void testToECF();
+    void testToLLA();
+    void testSensorConversions();
+};
+
+#endif	/* LOCALFRAMETEST_H */
+
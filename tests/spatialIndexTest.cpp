@@ -0,0 +1,193 @@
+/**
+ * @brief Spatial index tester implementation.
+ * @file spatialIndexTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the SpatialIndex range and elevation mask
+ * queries against a full scan, incremental updates and the parallel build.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include <algorithm>
+#include <stdexcept>
+#include "spatialIndexTest.h"
+#include "include/spatialIndex.h"
+#include "include/batchEngine.h"
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(spatialIndexTest);
+
+/*
+ * Checks that a query returned exactly the expected identifiers, ignoring
+ * order. Identifiers in the optional set may be returned or not.
+ */
+static void checkIds(std::vector<size_t> ids, std::vector<size_t> expected, const std::vector<size_t> &optional = std::vector<size_t>()){
+    std::sort(ids.begin(),ids.end());
+    std::sort(expected.begin(),expected.end());
+    CPPUNIT_ASSERT(std::adjacent_find(ids.begin(),ids.end()) == ids.end());
+    for (size_t i = 0; i < optional.size(); i++) {
+        std::vector<size_t>::iterator found = std::lower_bound(ids.begin(),ids.end(),optional[i]);
+        if (found != ids.end() && *found == optional[i]) {
+            ids.erase(found);
+        }
+    }
+    CPPUNIT_ASSERT(ids == expected);
+}
+
+spatialIndexTest::spatialIndexTest() {
+}
+
+spatialIndexTest::~spatialIndexTest() {
+}
+
+void spatialIndexTest::setUp() {
+    //ground targets and aircraft over the globe, and a few satellites
+    std::vector<double> lla(3*indexCount);
+    for (int i = 0; i < indexCount; i++) {
+        lla[3*i] = fmod(i*0.731,180.0)-90.0;
+        lla[3*i+1] = fmod(i*1.377,360.0)-180.0;
+        lla[3*i+2] = (i % 50 == 0) ? 400000.0 + fmod(i*977.0,36000000.0) : fmod(i*91.0,12000.0);
+    }
+    _ecf.resize(3*indexCount);
+    llaToECF(indexCount,&lla[0],&_ecf[0]);
+}
+
+void spatialIndexTest::tearDown() {
+}
+
+void spatialIndexTest::testWithinRange() {
+    SpatialIndex index(50000.0);
+    index.build(indexCount,&_ecf[0]);
+    CPPUNIT_ASSERT_EQUAL((size_t) indexCount,index.size());
+
+    double sites[3][3] = {{38.0, -77.0, 100.0}, {89.9, 10.0, 0.0}, {-20.0, 150.0, 500000.0}};
+    double ranges[4] = {1000.0, 300000.0, 2000000.0, 5.0e7};
+    std::vector<size_t> ids;
+    for (int s = 0; s < 3; s++) {
+        ECF site = LLA(sites[s][0],sites[s][1],sites[s][2]).toECF();
+        for (int r = 0; r < 4; r++) {
+            std::vector<size_t> expected;
+            for (size_t i = 0; i < indexCount; i++) {
+                double dx = _ecf[3*i]-site.getFirstCoordinate();
+                double dy = _ecf[3*i+1]-site.getSecondCoordinate();
+                double dz = _ecf[3*i+2]-site.getThirdCoordinate();
+                if (sqrt(dx*dx+dy*dy+dz*dz) <= ranges[r]) {
+                    expected.push_back(i);
+                }
+            }
+            index.withinRange(site,ranges[r],ids);
+            checkIds(ids,expected);
+        }
+    }
+}
+
+void spatialIndexTest::testAboveElevation() {
+    SpatialIndex index;
+    index.build(indexCount,&_ecf[0]);
+
+    double sites[3][3] = {{38.0, -77.0, 100.0}, {-89.5, 0.0, 2800.0}, {0.0, 179.9, 10000.0}};
+    double masks[4] = {-5.0, 0.0, 10.0, 60.0};
+    double ranges[2] = {HUGE_VAL, 1500000.0};
+    std::vector<size_t> ids;
+    for (int s = 0; s < 3; s++) {
+        LocalFrame frame(sites[s][0],sites[s][1],sites[s][2],45.0);
+        for (int m = 0; m < 4; m++) {
+            for (int r = 0; r < 2; r++) {
+                std::vector<size_t> expected, optional;
+                for (size_t i = 0; i < indexCount; i++) {
+                    AER aer = frame.toAER(ECF(_ecf[3*i],_ecf[3*i+1],_ecf[3*i+2]));
+                    if (aer.getThirdCoordinate() > ranges[r]) {
+                        continue;
+                    }
+                    if (fabs(aer.getSecondCoordinate()-masks[m]) < maskTol) {
+                        optional.push_back(i);
+                    } else if (aer.getSecondCoordinate() >= masks[m]) {
+                        expected.push_back(i);
+                    }
+                }
+                index.aboveElevation(frame,masks[m],ids,ranges[r]);
+                checkIds(ids,expected,optional);
+            }
+        }
+    }
+}
+
+void spatialIndexTest::testInsertRemove() {
+    SpatialIndex index(10000.0);
+    std::vector<size_t> ids;
+    ECF site = LLA(10.0,20.0,0.0).toECF();
+
+    index.insert(7,LLA(10.0,20.0,1000.0).toECF());
+    index.insert(42,LLA(10.05,20.0,0.0).toECF());
+    index.insert(9,LLA(-10.0,20.0,0.0).toECF());
+    CPPUNIT_ASSERT_EQUAL((size_t) 3,index.size());
+    index.withinRange(site,10000.0,ids);
+    checkIds(ids,{7, 42});
+
+    //moving a point replaces it
+    index.insert(42,LLA(10.5,20.0,0.0).toECF());
+    CPPUNIT_ASSERT_EQUAL((size_t) 3,index.size());
+    index.withinRange(site,10000.0,ids);
+    checkIds(ids,{7});
+    index.withinRange(site,100000.0,ids);
+    checkIds(ids,{7, 42});
+
+    CPPUNIT_ASSERT(index.remove(7));
+    CPPUNIT_ASSERT(!index.remove(7));
+    CPPUNIT_ASSERT_EQUAL((size_t) 2,index.size());
+    index.withinRange(site,100000.0,ids);
+    checkIds(ids,{42});
+
+    //updates after a build
+    index.build(indexCount,&_ecf[0]);
+    for (size_t i = 0; i < indexCount; i += 2) {
+        CPPUNIT_ASSERT(index.remove(i));
+    }
+    index.insert(indexCount,site);
+    index.withinRange(site,1.0e8,ids);
+    std::vector<size_t> expected;
+    for (size_t i = 1; i < indexCount; i += 2) {
+        expected.push_back(i);
+    }
+    expected.push_back(indexCount);
+    checkIds(ids,expected);
+
+    index.clear();
+    CPPUNIT_ASSERT_EQUAL((size_t) 0,index.size());
+    index.withinRange(site,1.0e8,ids);
+    CPPUNIT_ASSERT(ids.empty());
+}
+
+void spatialIndexTest::testParallelBuild() {
+    BatchEngine engine(4,512);
+    SpatialIndex serial, parallel;
+    std::vector<size_t> serialIds, parallelIds;
+    LocalFrame frame(38.0,-77.0,100.0);
+
+    serial.build(indexCount,&_ecf[0]);
+    parallel.build(indexCount,&_ecf[0],&engine);
+    CPPUNIT_ASSERT_EQUAL(serial.size(),parallel.size());
+    serial.withinRange(frame.getOriginECF(),3000000.0,serialIds);
+    parallel.withinRange(frame.getOriginECF(),3000000.0,parallelIds);
+    checkIds(parallelIds,serialIds);
+    serial.aboveElevation(frame,5.0,serialIds);
+    parallel.aboveElevation(frame,5.0,parallelIds);
+    checkIds(parallelIds,serialIds);
+
+    //every identifier can be removed from the parallel build
+    for (size_t i = 0; i < indexCount; i++) {
+        CPPUNIT_ASSERT(parallel.remove(i));
+    }
+    CPPUNIT_ASSERT_EQUAL((size_t) 0,parallel.size());
+}
+
+void spatialIndexTest::testCellSize() {
+    CPPUNIT_ASSERT_EQUAL(250.0,SpatialIndex(250.0).getCellSize());
+    CPPUNIT_ASSERT_THROW(SpatialIndex(0.0),std::runtime_error);
+    CPPUNIT_ASSERT_THROW(SpatialIndex(-1.0),std::runtime_error);
+    CPPUNIT_ASSERT_THROW(SpatialIndex(NAN),std::runtime_error);
+}
@@ -0,0 +1,48 @@
+/**
+ * @brief Spatial index tester definition.
+ * @file spatialIndexTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the SpatialIndex range and elevation mask
+ * queries against a full scan, incremental updates and the parallel build.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef SPATIALINDEXTEST_H
+#define	SPATIALINDEXTEST_H
+
+#include <vector>
+#include <cppunit/extensions/HelperMacros.h>
+
+#define indexCount 20011 //number of indexed points
+#define maskTol 1.0e-9 //points this close to the mask (degrees) may fall either side
+
+class spatialIndexTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(spatialIndexTest);
+
+    CPPUNIT_TEST(testWithinRange);
+    CPPUNIT_TEST(testAboveElevation);
+    CPPUNIT_TEST(testInsertRemove);
+    CPPUNIT_TEST(testParallelBuild);
+    CPPUNIT_TEST(testCellSize);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    spatialIndexTest();
+    virtual ~spatialIndexTest();
+    void setUp();
+    void tearDown();
+
+private:
+    std::vector<double> _ecf;
+    void testWithinRange();
+    void testAboveElevation();
+    void testInsertRemove();
+    void testParallelBuild();
+    void testCellSize();
+};
+
+#endif	/* SPATIALINDEXTEST_H */
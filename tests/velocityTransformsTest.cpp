@@ -0,0 +1,149 @@
+/**
+ * @brief Velocity transformation tester implementation.
+ * @file velocityTransformsTest.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the position and velocity conversions and the
+ * AER rates against differences of position conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#include <math.h>
+#include "velocityTransformsTest.h"
+#include "include/velocityTransforms.h"
+
+#define positionTol 1e-6 //meters
+#define velocityTol 1e-9 //meters per second
+#define rateTol 1e-6 //relative rate error of central differences
+
+using namespace coordinateSystems;
+
+CPPUNIT_TEST_SUITE_REGISTRATION(velocityTransformsTest);
+
+static const double dt = 1e-3; //seconds
+
+template <class V>
+static V advance(V position, V velocity, double t){
+    return V(position.first + t*velocity.first, position.second + t*velocity.second, position.third + t*velocity.third);
+}
+template <class V>
+static double speed(V velocity){
+    return sqrt(velocity.first*velocity.first + velocity.second*velocity.second + velocity.third*velocity.third);
+}
+template <class V>
+static void assertVecEqual(V expected, V actual, double tol){
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.first,actual.first,tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.second,actual.second,tol);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected.third,actual.third,tol);
+}
+
+velocityTransformsTest::velocityTransformsTest() {
+}
+
+velocityTransformsTest::~velocityTransformsTest() {
+}
+
+void velocityTransformsTest::setUp() {
+}
+
+void velocityTransformsTest::tearDown() {
+}
+
+void velocityTransformsTest::testRates() {
+    DCAVec positions[3] = {DCAVec(10000.0,-2000.0,3000.0), DCAVec(-500.0,800.0,-100.0), DCAVec(1.0,50000.0,20000.0)};
+    DCAVec velocity(250.0,-30.0,12.0);
+    for (int n = 0; n < 3; n++) {
+        AERVec rates = dcaToAERRates(positions[n],velocity);
+        AERVec ahead = toAER(advance(positions[n],velocity,dt));
+        AERVec behind = toAER(advance(positions[n],velocity,-dt));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.first - behind.first)/(2*dt),rates.first,rateTol*fabs(rates.first) + 1e-9);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.second - behind.second)/(2*dt),rates.second,rateTol*fabs(rates.second) + 1e-9);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.third - behind.third)/(2*dt),rates.third,rateTol*fabs(rates.third) + 1e-9);
+
+        //and back
+        assertVecEqual(velocity,aerToDCARates(toAER(positions[n]),rates),velocityTol);
+    }
+
+    //straight up: only the range rate is defined
+    AERVec vertical = dcaToAERRates(DCAVec(0.0,0.0,1000.0),velocity);
+    CPPUNIT_ASSERT_EQUAL(0.0,vertical.first);
+    CPPUNIT_ASSERT_EQUAL(12.0,vertical.third);
+}
+
+void velocityTransformsTest::testLocalVelocities() {
+    LocalFrame frame(38.0,-77.0,100.0,30.0);
+    ECFVec ecf[2] = {toVec3(LLA(38.5,-76.5,2000.0).toECF()), toVec3(LLA(37.9,-77.2,12000.0).toECF())};
+    ECFVec ecfVelocity[2] = {ECFVec(100.0,-200.0,50.0), ECFVec(-7.0,3.0,1500.0)};
+    ENUVec enu[2], enuVelocity[2];
+    DCAVec dca[2], dcaVelocity[2];
+    ECFVec back[2], backVelocity[2];
+
+    ecfToENUVelocity(2,ecf,ecfVelocity,enu,enuVelocity,frame);
+    ecfToDCAVelocity(2,ecf,ecfVelocity,dca,dcaVelocity,frame);
+    for (int n = 0; n < 2; n++) {
+        assertVecEqual(frame.toENU(ecf[n]),enu[n],positionTol);
+        assertVecEqual(frame.toDCA(ecf[n]),dca[n],positionTol);
+        //a local velocity is the rate of change of the local position
+        ENUVec ahead = frame.toENU(advance(ecf[n],ecfVelocity[n],dt));
+        ENUVec behind = frame.toENU(advance(ecf[n],ecfVelocity[n],-dt));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.first - behind.first)/(2*dt),enuVelocity[n].first,1e-5);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.second - behind.second)/(2*dt),enuVelocity[n].second,1e-5);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.third - behind.third)/(2*dt),enuVelocity[n].third,1e-5);
+        //speed is kept
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(speed(ecfVelocity[n]),speed(dcaVelocity[n]),velocityTol);
+    }
+
+    enuToECFVelocity(2,enu,enuVelocity,back,backVelocity,frame);
+    for (int n = 0; n < 2; n++) {
+        assertVecEqual(ecf[n],back[n],positionTol);
+        assertVecEqual(ecfVelocity[n],backVelocity[n],velocityTol);
+    }
+    dcaToECFVelocity(2,dca,dcaVelocity,back,backVelocity,frame);
+    for (int n = 0; n < 2; n++) {
+        assertVecEqual(ecf[n],back[n],positionTol);
+        assertVecEqual(ecfVelocity[n],backVelocity[n],velocityTol);
+    }
+}
+
+void velocityTransformsTest::testAERVelocities() {
+    LocalFrame frame(38.0,-77.0,100.0,30.0);
+    double positions[6], velocities[6] = {100.0, -200.0, 50.0, -7.0, 3.0, 1500.0};
+    double aer[6], rates[6], dca[6], dcaVelocity[6], twoStep[6], twoStepRates[6];
+    LLA targets[2] = {LLA(38.5,-76.5,2000.0), LLA(37.9,-77.2,12000.0)};
+    for (int n = 0; n < 2; n++) {
+        ECF target = targets[n].toECF();
+        positions[3*n] = target.getFirstCoordinate();
+        positions[3*n+1] = target.getSecondCoordinate();
+        positions[3*n+2] = target.getThirdCoordinate();
+    }
+
+    ecfToAERVelocity(2,positions,velocities,aer,rates,frame);
+    ecfToDCAVelocity(2,positions,velocities,dca,dcaVelocity,frame);
+    dcaToAERVelocity(2,dca,dcaVelocity,twoStep,twoStepRates);
+    for (int n = 0; n < 2; n++) {
+        ECFVec ecf(positions[3*n],positions[3*n+1],positions[3*n+2]);
+        ECFVec velocity(velocities[3*n],velocities[3*n+1],velocities[3*n+2]);
+        AERVec expected = frame.toAER(ecf);
+        assertVecEqual(expected,AERVec(aer[3*n],aer[3*n+1],aer[3*n+2]),positionTol);
+        assertVecEqual(AERVec(twoStep[3*n],twoStep[3*n+1],twoStep[3*n+2]),AERVec(aer[3*n],aer[3*n+1],aer[3*n+2]),positionTol);
+        assertVecEqual(AERVec(twoStepRates[3*n],twoStepRates[3*n+1],twoStepRates[3*n+2]),
+                AERVec(rates[3*n],rates[3*n+1],rates[3*n+2]),velocityTol);
+        AERVec ahead = frame.toAER(advance(ecf,velocity,dt));
+        AERVec behind = frame.toAER(advance(ecf,velocity,-dt));
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.first - behind.first)/(2*dt),rates[3*n],1e-6);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.second - behind.second)/(2*dt),rates[3*n+1],1e-6);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((ahead.third - behind.third)/(2*dt),rates[3*n+2],1e-5);
+    }
+
+    //back to ECF, in place
+    aerToECFVelocity(2,aer,rates,aer,rates,frame);
+    aerToDCAVelocity(2,twoStep,twoStepRates,twoStep,twoStepRates);
+    for (int n = 0; n < 6; n++) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(positions[n],aer[n],positionTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(velocities[n],rates[n],velocityTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(dca[n],twoStep[n],positionTol);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(dcaVelocity[n],twoStepRates[n],velocityTol);
+    }
+}
@@ -0,0 +1,39 @@
+/**
+ * @brief Velocity transformation tester definition.
+ * @file velocityTransformsTest.h
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Class for testing the position and velocity conversions and the
+ * AER rates against differences of position conversions.
+ * 
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+#ifndef VELOCITYTRANSFORMSTEST_H
+#define	VELOCITYTRANSFORMSTEST_H
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class velocityTransformsTest : public CPPUNIT_NS::TestFixture {
+    CPPUNIT_TEST_SUITE(velocityTransformsTest);
+
+    CPPUNIT_TEST(testRates);
+    CPPUNIT_TEST(testLocalVelocities);
+    CPPUNIT_TEST(testAERVelocities);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    velocityTransformsTest();
+    virtual ~velocityTransformsTest();
+    void setUp();
+    void tearDown();
+
+private:
+    void testRates();
+    void testLocalVelocities();
+    void testAERVelocities();
+};
+
+#endif	/* VELOCITYTRANSFORMSTEST_H */
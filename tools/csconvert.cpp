@@ -0,0 +1,439 @@
+/**
+ * @brief Streaming coordinate conversion tool.
+ * @file csconvert.cpp
+ * @version 26.10
+ * @date October 17, 2026
+ * @details Reads points as CSV or binary records from standard input or a
+ * file, converts them between any two of ECF, LLA, ENU, DCA and AER with a
+ * given origin and heading, and writes them out. Parsing, conversion and
+ * formatting run on three threads connected by bounded queues of point blocks,
+ * and the conversion uses the batch kernels.
+ *
+ * Version History:
+ * Version 26.10 on October 17, 2026
+ */
+
+/**
+ * Notices: Copyright 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration. All
+ * Rights Reserved.
+ *
+ * Disclaimers:
+ * No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT
+ * ANY WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY, INCLUDING,
+ * BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL CONFORM TO
+ * SPECIFICATIONS, ANY IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, OR FREEDOM FROM INFRINGEMENT, ANY WARRANTY THAT THE
+ * SUBJECT SOFTWARE WILL BE ERROR FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF
+ * PROVIDED, WILL CONFORM TO THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN
+ * ANY MANNER, CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR
+ * RECIPIENT OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR
+ * ANY OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.  FURTHER,
+ * GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES REGARDING
+ * THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE, AND DISTRIBUTES IT
+ * "AS IS."
+ *
+ * Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS AGAINST
+ * THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS
+ * ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF THE SUBJECT SOFTWARE RESULTS IN
+ * ANY LIABILITIES, DEMANDS, DAMAGES, EXPENSES OR LOSSES ARISING FROM SUCH USE,
+ * INCLUDING ANY DAMAGES FROM PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S
+ * USE OF THE SUBJECT SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE
+ * UNITED STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+ * PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE REMEDY FOR
+ * ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL TERMINATION OF THIS
+ * AGREEMENT.
+ */
+
+/*
+ * Build with optimization together with every source file in src/, with
+ * include/ on the include path, and link the thread library.
+ *
+ * Usage: csconvert --from FRAME --to FRAME [--origin LAT,LON,ALT]
+ *     [--heading DEG] [--input FILE] [--output FILE] [--input-format csv|binary]
+ *     [--output-format csv|binary] [--precision DIGITS] [--block POINTS]
+ *     [--queue BLOCKS]
+ *
+ * FRAME is one of ECF, LLA, ENU, DCA and AER (any case). ENU, DCA and AER
+ * need --origin; DCA and AER also use --heading (default 0). CSV records are
+ * lines with three comma, space or tab separated numbers; blank lines, lines
+ * starting with '#' and a non-numeric first line (a header) are skipped.
+ * Binary records are interleaved native doubles, as in bulkConversions.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "coordinateSystems.h"
+#include "localFrame.h"
+#include "batchConversions.h"
+
+using namespace coordinateSystems;
+
+/***** queues *****************************************************************/
+/*
+ * Block of points passed between the stages. An empty block with last set
+ * ends the stream; a block with an error message stops the pipeline.
+ */
+struct block {
+    std::vector<double> points; //interleaved triples
+    bool last;
+    std::string error;
+    block() : last(false){
+    }
+};
+
+/*
+ * Queue holding at most capacity blocks: push waits while it is full and
+ * pop waits while it is empty, so a slow stage throttles the one before it
+ * and memory stays bounded whatever the input size.
+ */
+class boundedQueue {
+public:
+    boundedQueue(size_t c) : capacity(c){
+    }
+    void push(block &&item){
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock,[this](){ return items.size() < capacity; });
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+    }
+    block pop(){
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock,[this](){ return !items.empty(); });
+        block item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return item;
+    }
+private:
+    size_t capacity;
+    std::deque<block> items;
+    std::mutex mutex;
+    std::condition_variable notFull, notEmpty;
+};
+
+/***** options ****************************************************************/
+enum frame {FRAME_ECF, FRAME_LLA, FRAME_ENU, FRAME_DCA, FRAME_AER, FRAME_NONE};
+
+struct options {
+    frame from, to;
+    bool originSet, binaryInput, binaryOutput;
+    double origin[3], heading;
+    std::string input, output;
+    int precision;
+    size_t blockPoints, queueBlocks;
+    options() : from(FRAME_NONE), to(FRAME_NONE), originSet(false), binaryInput(false), binaryOutput(false),
+    heading(0.0), precision(17), blockPoints(4096), queueBlocks(8){
+        origin[0] = origin[1] = origin[2] = 0.0;
+    }
+};
+
+static frame parseFrame(const char *name){
+    const char *names[] = {"ECF", "LLA", "ENU", "DCA", "AER"};
+    for (int i = 0; i < FRAME_NONE; i++) {
+        if (!strcasecmp(name,names[i])) {
+            return (frame)i;
+        }
+    }
+    return FRAME_NONE;
+}
+
+static bool parseFormat(const char *name, bool &binary){
+    binary = !strcmp(name,"binary");
+    return binary || !strcmp(name,"csv");
+}
+
+static int usage(const char *program){
+    fprintf(stderr,"Usage: %s --from FRAME --to FRAME [--origin LAT,LON,ALT] [--heading DEG]\n"
+            "    [--input FILE] [--output FILE] [--input-format csv|binary] [--output-format csv|binary]\n"
+            "    [--precision DIGITS] [--block POINTS] [--queue BLOCKS]\n"
+            "FRAME is one of ECF, LLA, ENU, DCA and AER.\n",program);
+    return 2;
+}
+
+/***** conversion *************************************************************/
+typedef std::function<void(size_t, const double*, double*)> conversion;
+
+//batch conversion between two frames; local frames use the given frame
+static conversion selectConversion(frame from, frame to, LocalFrame &local){
+    LocalFrame *f = &local;
+    double heading = local.getHeading();
+    switch (from*FRAME_NONE + to) {
+        case FRAME_ECF*FRAME_NONE + FRAME_LLA: return [](size_t n, const double *in, double *out){ ecfToLLA(n,in,out); };
+        case FRAME_ECF*FRAME_NONE + FRAME_ENU: return [f](size_t n, const double *in, double *out){ ecfToENU(n,in,out,*f); };
+        case FRAME_ECF*FRAME_NONE + FRAME_DCA: return [f](size_t n, const double *in, double *out){ ecfToDCA(n,in,out,*f); };
+        case FRAME_ECF*FRAME_NONE + FRAME_AER: return [f](size_t n, const double *in, double *out){ ecfToAER(n,in,out,*f); };
+        case FRAME_LLA*FRAME_NONE + FRAME_ECF: return [](size_t n, const double *in, double *out){ llaToECF(n,in,out); };
+        case FRAME_LLA*FRAME_NONE + FRAME_ENU: return [f](size_t n, const double *in, double *out){ llaToENU(n,in,out,*f); };
+        case FRAME_LLA*FRAME_NONE + FRAME_DCA: return [f](size_t n, const double *in, double *out){ llaToDCA(n,in,out,*f); };
+        case FRAME_LLA*FRAME_NONE + FRAME_AER: return [f](size_t n, const double *in, double *out){ llaToAER(n,in,out,*f); };
+        case FRAME_ENU*FRAME_NONE + FRAME_ECF: return [f](size_t n, const double *in, double *out){ enuToECF(n,in,out,*f); };
+        case FRAME_ENU*FRAME_NONE + FRAME_LLA: return [f](size_t n, const double *in, double *out){ enuToLLA(n,in,out,*f); };
+        case FRAME_ENU*FRAME_NONE + FRAME_DCA: return [f](size_t n, const double *in, double *out){ enuToDCA(n,in,out,*f); };
+        case FRAME_ENU*FRAME_NONE + FRAME_AER: return [f](size_t n, const double *in, double *out){ enuToAER(n,in,out,*f); };
+        case FRAME_DCA*FRAME_NONE + FRAME_ECF: return [f](size_t n, const double *in, double *out){ dcaToECF(n,in,out,*f); };
+        case FRAME_DCA*FRAME_NONE + FRAME_LLA: return [f](size_t n, const double *in, double *out){ dcaToLLA(n,in,out,*f); };
+        case FRAME_DCA*FRAME_NONE + FRAME_ENU: return [f](size_t n, const double *in, double *out){ dcaToENU(n,in,out,*f); };
+        case FRAME_DCA*FRAME_NONE + FRAME_AER: return [](size_t n, const double *in, double *out){ dcaToAER(n,in,out); };
+        case FRAME_AER*FRAME_NONE + FRAME_ECF: return [f](size_t n, const double *in, double *out){ aerToECF(n,in,out,*f); };
+        case FRAME_AER*FRAME_NONE + FRAME_LLA: return [f](size_t n, const double *in, double *out){ aerToLLA(n,in,out,*f); };
+        case FRAME_AER*FRAME_NONE + FRAME_ENU: return [heading](size_t n, const double *in, double *out){ aerToENU(n,in,out,heading); };
+        case FRAME_AER*FRAME_NONE + FRAME_DCA: return [](size_t n, const double *in, double *out){ aerToDCA(n,in,out); };
+        default: return [](size_t n, const double *in, double *out){ memmove(out,in,3*n*sizeof(double)); };
+    }
+}
+
+/***** stages *****************************************************************/
+/*
+ * Splits CSV text into records. Input is read in large pieces and split on
+ * newlines; a partial line at the end of a piece is carried into the next.
+ */
+class csvParser {
+public:
+    csvParser() : line(0), seenRecord(false){
+    }
+    //parses one line into points; returns false with a message on a bad record
+    bool parseLine(const char *begin, const char *end, std::vector<double> &points, std::string &error){
+        double values[3];
+        const char *p = begin;
+        line++;
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            p++;
+        }
+        if (p == end || *p == '#') {
+            return true;
+        }
+        text.assign(p,end); //terminated copy for strtod, reusing its storage
+        const char *s = text.c_str();
+        for (int i = 0; i < 3; i++) {
+            char *next;
+            while (*s == ' ' || *s == '\t' || (i > 0 && *s == ',')) {
+                s++;
+            }
+            values[i] = strtod(s,&next);
+            if (next == s) {
+                if (i == 0 && !seenRecord) {
+                    return true; //header
+                }
+                error = "line " + std::to_string(line) + ": expected three numbers";
+                return false;
+            }
+            s = next;
+        }
+        while (*s == ' ' || *s == '\t' || *s == '\r') {
+            s++;
+        }
+        if (*s != '\0') {
+            error = "line " + std::to_string(line) + ": expected three numbers";
+            return false;
+        }
+        seenRecord = true;
+        points.insert(points.end(),values,values + 3);
+        return true;
+    }
+private:
+    size_t line;
+    bool seenRecord;
+    std::string text;
+};
+
+static void readStage(FILE *input, const options &opts, boundedQueue &parsed){
+    const size_t pieceBytes = 1 << 20;
+    std::vector<char> piece(pieceBytes);
+    std::string carry;
+    csvParser parser;
+    block current;
+    size_t blockValues = 3*opts.blockPoints;
+
+    current.points.reserve(blockValues);
+    while (true) {
+        size_t bytes;
+        if (opts.binaryInput) {
+            current.points.resize(blockValues);
+            bytes = fread(&current.points[0],1,blockValues*sizeof(double),input);
+            if (bytes % (3*sizeof(double)) != 0) {
+                current.error = "input ends inside a record";
+                parsed.push(std::move(current));
+                return;
+            }
+            current.points.resize(bytes/sizeof(double));
+            if (bytes == 0) {
+                break;
+            }
+            parsed.push(std::move(current));
+            current = block();
+            continue;
+        }
+
+        bytes = fread(&piece[0],1,pieceBytes,input);
+        if (bytes == 0) {
+            break;
+        }
+        carry.append(&piece[0],bytes);
+        size_t start = 0, newline;
+        while ((newline = carry.find('\n',start)) != std::string::npos) {
+            if (!parser.parseLine(carry.data() + start,carry.data() + newline,current.points,current.error)) {
+                parsed.push(std::move(current));
+                return;
+            }
+            start = newline + 1;
+            if (current.points.size() >= blockValues) {
+                parsed.push(std::move(current));
+                current = block();
+                current.points.reserve(blockValues);
+            }
+        }
+        carry.erase(0,start);
+    }
+    if (!opts.binaryInput && !carry.empty() &&
+            !parser.parseLine(carry.data(),carry.data() + carry.size(),current.points,current.error)) {
+        parsed.push(std::move(current));
+        return;
+    }
+    if (ferror(input)) {
+        current.error = "read error";
+        parsed.push(std::move(current));
+        return;
+    }
+    current.last = true;
+    parsed.push(std::move(current));
+}
+
+static void convertStage(const conversion &convert, boundedQueue &parsed, boundedQueue &converted){
+    while (true) {
+        block item = parsed.pop();
+        bool stop = item.last || !item.error.empty();
+        size_t count = item.points.size()/3;
+        if (count > 0) {
+            convert(count,&item.points[0],&item.points[0]);
+        }
+        converted.push(std::move(item));
+        if (stop) {
+            return;
+        }
+    }
+}
+
+//formats and writes blocks until the end of the stream; returns false on error
+static bool writeStage(FILE *output, const options &opts, boundedQueue &converted){
+    std::vector<char> text;
+    char number[64];
+
+    while (true) {
+        block item = converted.pop();
+        if (opts.binaryOutput) {
+            if (!item.points.empty()) {
+                fwrite(&item.points[0],sizeof(double),item.points.size(),output);
+            }
+        } else {
+            text.clear();
+            for (size_t i = 0; i < item.points.size(); i++) {
+                int length = snprintf(number,sizeof(number),"%.*g",opts.precision,item.points[i]);
+                text.insert(text.end(),number,number + length);
+                text.push_back((i % 3 == 2) ? '\n' : ',');
+            }
+            if (!text.empty()) {
+                fwrite(&text[0],1,text.size(),output);
+            }
+        }
+        if (!item.error.empty()) {
+            fprintf(stderr,"csconvert: %s\n",item.error.c_str());
+            return false;
+        }
+        if (item.last) {
+            return !ferror(output);
+        }
+    }
+}
+
+/***** main *******************************************************************/
+int main(int argc, char **argv){
+    options opts;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            return usage(argv[0]);
+        } else if (!strcmp(argv[i],"--from")) {
+            opts.from = parseFrame(argv[++i]);
+        } else if (!strcmp(argv[i],"--to")) {
+            opts.to = parseFrame(argv[++i]);
+        } else if (!strcmp(argv[i],"--origin")) {
+            opts.originSet = sscanf(argv[++i],"%lf,%lf,%lf",&opts.origin[0],&opts.origin[1],&opts.origin[2]) == 3;
+            if (!opts.originSet) {
+                return usage(argv[0]);
+            }
+        } else if (!strcmp(argv[i],"--heading")) {
+            opts.heading = atof(argv[++i]);
+        } else if (!strcmp(argv[i],"--input")) {
+            opts.input = argv[++i];
+        } else if (!strcmp(argv[i],"--output")) {
+            opts.output = argv[++i];
+        } else if (!strcmp(argv[i],"--input-format")) {
+            if (!parseFormat(argv[++i],opts.binaryInput)) {
+                return usage(argv[0]);
+            }
+        } else if (!strcmp(argv[i],"--output-format")) {
+            if (!parseFormat(argv[++i],opts.binaryOutput)) {
+                return usage(argv[0]);
+            }
+        } else if (!strcmp(argv[i],"--precision")) {
+            opts.precision = atoi(argv[++i]);
+        } else if (!strcmp(argv[i],"--block")) {
+            opts.blockPoints = strtoul(argv[++i],NULL,10);
+        } else if (!strcmp(argv[i],"--queue")) {
+            opts.queueBlocks = strtoul(argv[++i],NULL,10);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (opts.from == FRAME_NONE || opts.to == FRAME_NONE || opts.blockPoints == 0 || opts.queueBlocks == 0 ||
+            opts.precision < 1 || opts.precision > 17) {
+        return usage(argv[0]);
+    }
+    bool local = opts.from >= FRAME_ENU || opts.to >= FRAME_ENU;
+    if (local && !opts.originSet && opts.from != opts.to) {
+        fprintf(stderr,"csconvert: --origin is required for ENU, DCA and AER\n");
+        return 2;
+    }
+
+    FILE *input = opts.input.empty() ? stdin : fopen(opts.input.c_str(),"rb");
+    if (input == NULL) {
+        fprintf(stderr,"csconvert: cannot open %s\n",opts.input.c_str());
+        return 1;
+    }
+    FILE *output = opts.output.empty() ? stdout : fopen(opts.output.c_str(),"wb");
+    if (output == NULL) {
+        fprintf(stderr,"csconvert: cannot open %s\n",opts.output.c_str());
+        return 1;
+    }
+
+    LocalFrame frame(opts.origin[0],opts.origin[1],opts.origin[2],opts.heading);
+    conversion convert = selectConversion(opts.from,opts.to,frame);
+    boundedQueue parsed(opts.queueBlocks), converted(opts.queueBlocks);
+
+    std::thread reader(readStage,input,std::cref(opts),std::ref(parsed));
+    std::thread converter(convertStage,std::cref(convert),std::ref(parsed),std::ref(converted));
+    bool success = writeStage(output,opts,converted);
+    reader.join();
+    converter.join();
+
+    if (input != stdin) {
+        fclose(input);
+    }
+    if (output != stdout) {
+        success = (fclose(output) == 0) && success;
+    } else {
+        success = (fflush(output) == 0) && success;
+    }
+    return success ? 0 : 1;
+}